@@ -1,18 +1,39 @@
 #include "Buffer.h"
 #include "Device.h"
 #include "PhysicalDevice.h"
-#include "CommandPool.h"
+#include "MemoryAllocator.h"
 #include <stdexcept>
 
 
-Buffer::Buffer(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device)
+Buffer::Buffer(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
+	std::shared_ptr<MemoryAllocator> memoryAllocator)
 {
 	this->device = device;
 	this->physicalDevice = physicalDevice;
+	this->memoryAllocator = memoryAllocator;
 }
 
 void Buffer::createBuffer(VkDeviceSize size, VkBufferUsageFlags usageFlags, VkMemoryPropertyFlags propertyFlags,
-	VkBuffer* outBuffer, VkDeviceMemory* outDeviceMemory)
+	VkBuffer* outBuffer, MemoryAllocation* outAllocation)
+{
+	createVkBuffer(size, usageFlags, outBuffer);
+	*outAllocation = memoryAllocator->allocateBufferMemory(*outBuffer, propertyFlags, 0);
+}
+
+void Buffer::createHostVisibleBuffer(VkDeviceSize size, VkBufferUsageFlags usageFlags, VkBuffer* outBuffer,
+	MemoryAllocation* outAllocation)
+{
+	createVkBuffer(size, usageFlags, outBuffer);
+	*outAllocation = memoryAllocator->allocateBufferMemory(*outBuffer, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+		VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+}
+
+void Buffer::flushHostVisibleBuffer(const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size)
+{
+	memoryAllocator->flush(allocation, offset, size);
+}
+
+void Buffer::createVkBuffer(VkDeviceSize size, VkBufferUsageFlags usageFlags, VkBuffer* outBuffer)
 {
 	VkBufferCreateInfo bufferCreateInfo = {};
 	bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -22,67 +43,18 @@ void Buffer::createBuffer(VkDeviceSize size, VkBufferUsageFlags usageFlags, VkMe
 
 	VkResult result = vkCreateBuffer(device->getHandle(), &bufferCreateInfo, nullptr, outBuffer);
 	throwIfCreateBufferFailed(result);
-
-	VkMemoryRequirements vertexBufferMemRequirements;
-	vkGetBufferMemoryRequirements(device->getHandle(), *outBuffer, &vertexBufferMemRequirements);
-
-	VkMemoryAllocateInfo memoryAllocateInfo = {};
-	memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-	memoryAllocateInfo.allocationSize = vertexBufferMemRequirements.size;
-	memoryAllocateInfo.memoryTypeIndex = physicalDevice->findMemoryType(vertexBufferMemRequirements.memoryTypeBits,
-		propertyFlags);
-
-	result = vkAllocateMemory(device->getHandle(), &memoryAllocateInfo, nullptr, outDeviceMemory);
-	throwIfAllocateMemoryFailed(result);
-
-	vkBindBufferMemory(device->getHandle(), *outBuffer, *outDeviceMemory, 0);
 }
 
-void Buffer::throwIfCreateBufferFailed(VkResult result) const
+void Buffer::destroyBuffer(VkBuffer buffer, const MemoryAllocation& allocation)
 {
-	if (result != VK_SUCCESS)
-	{
-		throw std::runtime_error("Failed to create buffer.");
-	}
+	vkDestroyBuffer(device->getHandle(), buffer, nullptr);
+	memoryAllocator->free(allocation);
 }
 
-void Buffer::throwIfAllocateMemoryFailed(VkResult result) const
+void Buffer::throwIfCreateBufferFailed(VkResult result) const
 {
 	if (result != VK_SUCCESS)
 	{
-		throw std::runtime_error("Failed to allocate buffer memory.");
+		throw std::runtime_error("Failed to create buffer.");
 	}
-}
-
-void Buffer::copyBuffer(std::shared_ptr<CommandPool> commandPool, VkDeviceSize size, VkBuffer srcBuffer, VkBuffer dstBuffer)
-{
-	VkCommandBufferAllocateInfo commandBufferAllocateInfo = {};
-	commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-	commandBufferAllocateInfo.commandBufferCount = 1;
-	commandBufferAllocateInfo.commandPool = commandPool->getHandle();
-	commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-
-	VkCommandBuffer commandBuffer;
-	vkAllocateCommandBuffers(device->getHandle(), &commandBufferAllocateInfo, &commandBuffer);
-
-	VkCommandBufferBeginInfo commandBufferBeginInfo = {};
-	commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-	commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-
-	vkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo);
-
-	VkBufferCopy copyRegion = {};
-	copyRegion.size = size;
-
-	vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, 1, &copyRegion);
-	vkEndCommandBuffer(commandBuffer);
-
-	VkSubmitInfo submitInfo = {};
-	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-	submitInfo.commandBufferCount = 1;
-	submitInfo.pCommandBuffers = &commandBuffer;
-
-	vkQueueSubmit(device->getGraphicsQueueHandle(), 1, &submitInfo, VK_NULL_HANDLE);
-	vkQueueWaitIdle(device->getGraphicsQueueHandle());
-	vkFreeCommandBuffers(device->getHandle(), commandPool->getHandle(), 1, &commandBuffer);
 }
\ No newline at end of file
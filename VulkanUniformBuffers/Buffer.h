@@ -2,30 +2,34 @@
 
 #include <vulkan.h>
 #include <memory>
+#include "MemoryAllocation.h"
 
 class Device;
 class PhysicalDevice;
-class CommandPool;
+class MemoryAllocator;
 
 
 class Buffer
 {
 private:
+	void createVkBuffer(VkDeviceSize size, VkBufferUsageFlags usageFlags, VkBuffer* outBuffer);
 	void throwIfCreateBufferFailed(VkResult result) const;
-	void throwIfAllocateMemoryFailed(VkResult result) const;
 
 protected:
-	VkBuffer* outBuffer;
-	VkDeviceMemory* outDeviceMemory;
-
 	std::shared_ptr<Device> device;
 	std::shared_ptr<PhysicalDevice> physicalDevice;
+	std::shared_ptr<MemoryAllocator> memoryAllocator;
 
 	void createBuffer(VkDeviceSize size, VkBufferUsageFlags usageFlags, VkMemoryPropertyFlags propertyFlags,
-		VkBuffer* outBuffer, VkDeviceMemory* outDeviceMemory);
+		VkBuffer* outBuffer, MemoryAllocation* outAllocation);
+
+	void createHostVisibleBuffer(VkDeviceSize size, VkBufferUsageFlags usageFlags, VkBuffer* outBuffer,
+		MemoryAllocation* outAllocation);
 
-	void copyBuffer(std::shared_ptr<CommandPool> commandPool, VkDeviceSize size, VkBuffer srcBuffer, VkBuffer dstBuffer);
+	void flushHostVisibleBuffer(const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size);
+	void destroyBuffer(VkBuffer buffer, const MemoryAllocation& allocation);
 
 public:
-	Buffer(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device);
+	Buffer(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
+		std::shared_ptr<MemoryAllocator> memoryAllocator);
 };
\ No newline at end of file
@@ -0,0 +1,149 @@
+#include "Camera.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+
+Camera::Camera()
+	: xUnit(1.0f, 0.0f, 0.0f),
+	yUnit(0.0f, 1.0f, 0.0f),
+	zUnit(0.0f, 0.0f, 1.0f),
+	position(0.0f, 0.0f, 0.0f),
+	yaw(0.0f),
+	pitch(0.0f),
+	orientation(1.0f, 0.0f, 0.0f, 0.0f),
+	aspectRatio(1.0f),
+	view(1.0f),
+	projection(1.0f),
+	viewProjection(1.0f),
+	viewDirty(true),
+	projectionDirty(true),
+	viewProjectionDirty(true)
+{
+}
+
+void Camera::setPosition(const glm::vec3& position)
+{
+	this->position = position;
+	viewDirty = true;
+}
+
+void Camera::setAspectRatio(float aspectRatio)
+{
+	if (aspectRatio == this->aspectRatio)
+	{
+		return;
+	}
+
+	this->aspectRatio = aspectRatio;
+	projectionDirty = true;
+}
+
+void Camera::update(const InputState& inputState, float deltaSec)
+{
+	move(inputState, deltaSec);
+	rotate(inputState);
+}
+
+CameraState Camera::getState() const
+{
+	CameraState cameraState;
+	cameraState.position = position;
+	cameraState.orientation = orientation;
+
+	return cameraState;
+}
+
+void Camera::setState(const CameraState& cameraState)
+{
+	position = cameraState.position;
+	orientation = cameraState.orientation;
+	viewDirty = true;
+}
+
+void Camera::move(const InputState& inputState, float deltaSec)
+{
+	float forwardAxis = (inputState.forward ? 1.0f : 0.0f) - (inputState.backward ? 1.0f : 0.0f);
+	float rightAxis = (inputState.right ? 1.0f : 0.0f) - (inputState.left ? 1.0f : 0.0f);
+
+	if (forwardAxis == 0.0f && rightAxis == 0.0f)
+	{
+		return;
+	}
+
+	glm::vec3 forwardVec = orientation * -zUnit;
+	glm::vec3 rightVec = orientation * xUnit;
+
+	position += (forwardVec * forwardAxis + rightVec * rightAxis) * speed * deltaSec;
+	viewDirty = true;
+}
+
+void Camera::rotate(const InputState& inputState)
+{
+	if (!inputState.mouseRight || (inputState.mouseXRel == 0 && inputState.mouseYRel == 0))
+	{
+		return;
+	}
+
+	pitch -= static_cast<float>(inputState.mouseYRel) * angleSpeed;
+	yaw -= static_cast<float>(inputState.mouseXRel) * angleSpeed;
+
+	orientation = glm::angleAxis(yaw, yUnit) * glm::angleAxis(pitch, xUnit);
+	viewDirty = true;
+}
+
+// The camera transform is a rotation plus a translation, so its inverse is the transposed rotation
+// and the rotated, negated position; no general 4x4 inverse is needed.
+void Camera::updateView() const
+{
+	glm::mat3 inverseRotation = glm::transpose(glm::mat3_cast(orientation));
+	glm::vec3 inverseTranslation = -(inverseRotation * position);
+
+	view = glm::mat4(inverseRotation);
+	view[3] = glm::vec4(inverseTranslation, 1.0f);
+
+	viewDirty = false;
+	viewProjectionDirty = true;
+}
+
+void Camera::updateProjection() const
+{
+	projection = glm::perspective(glm::radians(fieldOfView), aspectRatio, nearPlane, farPlane);
+	projection = glm::scale(projection, glm::vec3(1.0f, -1.0f, 1.0f));
+
+	projectionDirty = false;
+	viewProjectionDirty = true;
+}
+
+const glm::mat4& Camera::getView() const
+{
+	if (viewDirty)
+	{
+		updateView();
+	}
+
+	return view;
+}
+
+const glm::mat4& Camera::getProjection() const
+{
+	if (projectionDirty)
+	{
+		updateProjection();
+	}
+
+	return projection;
+}
+
+const glm::mat4& Camera::getViewProjection() const
+{
+	const glm::mat4& currentView = getView();
+	const glm::mat4& currentProjection = getProjection();
+
+	if (viewProjectionDirty)
+	{
+		viewProjection = currentProjection * currentView;
+		viewProjectionDirty = false;
+	}
+
+	return viewProjection;
+}
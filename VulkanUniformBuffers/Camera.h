@@ -0,0 +1,54 @@
+#pragma once
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+
+#include "glm/vec3.hpp"
+#include "glm/mat4x4.hpp"
+#include <glm/gtc/quaternion.hpp>
+#include "InputState.h"
+#include "CameraState.h"
+
+
+class Camera
+{
+private:
+	const float angleSpeed = 0.01f;
+	const float speed = 1.0f;
+	const float fieldOfView = 45.0f;
+	const float nearPlane = 0.1f;
+	const float farPlane = 100.0f;
+	const glm::vec3 xUnit;
+	const glm::vec3 yUnit;
+	const glm::vec3 zUnit;
+
+	glm::vec3 position;
+	float yaw;
+	float pitch;
+	glm::quat orientation;
+	float aspectRatio;
+
+	mutable glm::mat4 view;
+	mutable glm::mat4 projection;
+	mutable glm::mat4 viewProjection;
+	mutable bool viewDirty;
+	mutable bool projectionDirty;
+	mutable bool viewProjectionDirty;
+
+	void move(const InputState& inputState, float deltaSec);
+	void rotate(const InputState& inputState);
+	void updateView() const;
+	void updateProjection() const;
+
+public:
+	Camera();
+
+	void setPosition(const glm::vec3& position);
+	void setAspectRatio(float aspectRatio);
+	void update(const InputState& inputState, float deltaSec);
+	CameraState getState() const;
+	void setState(const CameraState& cameraState);
+	const glm::mat4& getView() const;
+	const glm::mat4& getProjection() const;
+	const glm::mat4& getViewProjection() const;
+};
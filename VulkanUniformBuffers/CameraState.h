@@ -0,0 +1,14 @@
+#pragma once
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+
+#include "glm/vec3.hpp"
+#include <glm/gtc/quaternion.hpp>
+
+
+struct CameraState
+{
+	glm::vec3 position;
+	glm::quat orientation;
+};
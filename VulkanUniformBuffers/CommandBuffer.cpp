@@ -1,5 +1,6 @@
 #include "CommandBuffer.h"
 #include <array>
+#include <algorithm>
 #include "Framebuffer.h"
 #include "Device.h"
 #include "CommandPool.h"
@@ -8,74 +9,343 @@
 #include "GraphicsPipeline.h"
 #include "VertexBuffer.h"
 #include "IndexBuffer.h"
+#include "InstanceBuffer.h"
+#include "CullingPass.h"
 #include "UniformBuffer.h"
+#include "GpuProfiler.h"
+#include "WorkerPool.h"
+#include <chrono>
 
 
 CommandBuffer::CommandBuffer(std::shared_ptr<Device> device, std::shared_ptr<RenderPass> renderPass, 
 	std::shared_ptr<Framebuffer> frameBuffer, std::shared_ptr<CommandPool> commandPool,
 	std::shared_ptr<SwapChain> swapChain, std::shared_ptr<GraphicsPipeline> graphicsPipeline,
 	std::shared_ptr<VertexBuffer> vertexBuffer, std::shared_ptr<IndexBuffer> indexBuffer,
-	std::shared_ptr<UniformBuffer> uniformBuffer)
+	std::shared_ptr<InstanceBuffer> instanceBuffer, std::shared_ptr<CullingPass> cullingPass,
+	std::shared_ptr<UniformBuffer> uniformBuffer, std::shared_ptr<GpuProfiler> gpuProfiler,
+	const std::vector<ObjectPushConstants>& objects, uint32_t recordingWorkerCount,
+	CommandRecordingMode recordingMode, uint32_t frameSlotCount)
+	: recordingMode(recordingMode),
+	activeWorkerCount(0)
 {
-	vkCommandBuffers.resize(frameBuffer->getCount());
+	this->device = device;
+	this->commandPool = commandPool;
+	this->renderPass = renderPass;
+	this->frameBuffer = frameBuffer;
+	this->swapChain = swapChain;
+	this->graphicsPipeline = graphicsPipeline;
+	this->vertexBuffer = vertexBuffer;
+	this->indexBuffer = indexBuffer;
+	this->instanceBuffer = instanceBuffer;
+	this->cullingPass = cullingPass;
+	this->uniformBuffer = uniformBuffer;
+	this->gpuProfiler = gpuProfiler;
+	this->objects = objects;
 
-	VkCommandBufferAllocateInfo commandBufferInfo = buildCommandBufferAllocateInfo(commandPool);
+	bool perFrame = recordingMode == CommandRecordingMode::PerFrame;
+	createPrimaryCommandBuffers(perFrame ? frameSlotCount : static_cast<uint32_t>(frameBuffer->getCount()));
 
-	VkResult result = vkAllocateCommandBuffers(device->getHandle(), &commandBufferInfo, vkCommandBuffers.data());
-	throwAllocateCommandBufferFailed(result);
+	if (recordingWorkerCount > 1 && objects.size() > 1)
+	{
+		createSecondaryCommandBuffers(recordingWorkerCount);
+	}
+
+	if (!perFrame)
+	{
+		for (uint32_t i = 0; i < vkCommandBuffers.size(); ++i)
+		{
+			recordCommandBuffer(i, i);
+		}
+	}
+}
+
+// Prerecorded buffers are indexed by swapchain image. Per-frame buffers are indexed by frame in flight. Each slot
+// gets a pool of its own so the whole slot can be recycled with one pool reset, which also lets a prerecorded
+// image be re-recorded on its own.
+void CommandBuffer::createPrimaryCommandBuffers(uint32_t slotCount)
+{
+	vkCommandBuffers.resize(slotCount);
+
+	for (uint32_t slot = 0; slot < slotCount; ++slot)
+	{
+		slotCommandPools.push_back(std::make_shared<CommandPool>(device, commandPool->getQueueFamilyIndex(),
+			getCommandPoolFlags()));
+
+		VkCommandBufferAllocateInfo commandBufferInfo = buildCommandBufferAllocateInfo(
+			slotCommandPools[slot]->getHandle(), VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1);
+
+		VkResult result = vkAllocateCommandBuffers(device->getHandle(), &commandBufferInfo, &vkCommandBuffers[slot]);
+		throwAllocateCommandBufferFailed(result);
+	}
+}
+
+// Command pools are externally synchronized, so every worker records into buffers from a pool of its own, one per
+// recording slot.
+void CommandBuffer::createSecondaryCommandBuffers(uint32_t recordingWorkerCount)
+{
+	workerPool = std::make_shared<WorkerPool>(recordingWorkerCount);
+	activeWorkerCount = std::min(workerPool->getWorkerCount(), static_cast<uint32_t>(objects.size()));
+
+	secondaryCommandPools.resize(vkCommandBuffers.size());
+	vkSecondaryCommandBuffers.resize(vkCommandBuffers.size());
 
 	for (size_t i = 0; i < vkCommandBuffers.size(); ++i)
 	{
-		VkCommandBufferBeginInfo beginInfo = {};
-		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		vkSecondaryCommandBuffers[i].resize(activeWorkerCount);
+
+		for (uint32_t workerIndex = 0; workerIndex < activeWorkerCount; ++workerIndex)
+		{
+			std::shared_ptr<CommandPool> workerCommandPool = std::make_shared<CommandPool>(device,
+				commandPool->getQueueFamilyIndex(), getCommandPoolFlags());
+			secondaryCommandPools[i].push_back(workerCommandPool);
+
+			VkCommandBufferAllocateInfo commandBufferInfo = buildCommandBufferAllocateInfo(
+				workerCommandPool->getHandle(), VK_COMMAND_BUFFER_LEVEL_SECONDARY, 1);
+
+			VkResult result = vkAllocateCommandBuffers(device->getHandle(), &commandBufferInfo,
+				&vkSecondaryCommandBuffers[i][workerIndex]);
+			throwAllocateCommandBufferFailed(result);
+		}
+	}
+}
+
+VkCommandPoolCreateFlags CommandBuffer::getCommandPoolFlags() const
+{
+	return recordingMode == CommandRecordingMode::PerFrame ? VK_COMMAND_POOL_CREATE_TRANSIENT_BIT : 0;
+}
+
+VkCommandBufferUsageFlags CommandBuffer::getCommandBufferUsageFlags() const
+{
+	return recordingMode == CommandRecordingMode::PerFrame ? VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT : 0;
+}
+
+// Only called once the slot's fence or timeline value has been waited on, so nothing recorded from its pools is
+// still pending. Per-frame slots are frames in flight; prerecorded slots are swapchain images.
+void CommandBuffer::recordFrame(uint32_t slot, uint32_t imageIndex, const std::vector<ObjectPushConstants>& objects)
+{
+	using namespace std::chrono;
+
+	high_resolution_clock::time_point start = high_resolution_clock::now();
+
+	slotCommandPools[slot]->reset();
+
+	if (workerPool)
+	{
+		for (const std::shared_ptr<CommandPool>& workerCommandPool : secondaryCommandPools[slot])
+		{
+			workerCommandPool->reset();
+		}
+	}
 
-		result = vkBeginCommandBuffer(vkCommandBuffers[i], &beginInfo);
-		throwBeginCommandBufferFailed(result);
+	this->objects = objects;
+	recordCommandBuffer(slot, imageIndex);
 
-		VkRenderPassBeginInfo renderPassInfo = {};
-		renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-		renderPassInfo.renderPass = renderPass->getHandle();
-		renderPassInfo.framebuffer = frameBuffer->getHandle(i);
-		renderPassInfo.renderArea.offset = { 0, 0 };
-		renderPassInfo.renderArea.extent = swapChain->getSwapChainExtent();
+	recordingTimer.addSample(duration<double, std::milli>(high_resolution_clock::now() - start).count());
+}
 
-		std::array<VkClearValue, 2> clearValues;
-		clearValues[0] = { 0.0f, 0.0f, 0.0f, 1.0f };
-		clearValues[1] = { 1.0f, 0 };
+void CommandBuffer::recordCommandBuffer(uint32_t slot, uint32_t imageIndex)
+{
+	VkCommandBuffer vkCommandBuffer = vkCommandBuffers[slot];
 
-		renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
-		renderPassInfo.pClearValues = clearValues.data();
+	VkCommandBufferBeginInfo beginInfo = {};
+	beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	beginInfo.flags = getCommandBufferUsageFlags();
 
-		vkCmdBeginRenderPass(vkCommandBuffers[i], &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
-		vkCmdBindPipeline(vkCommandBuffers[i], VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline->getHandle());
+	VkResult result = vkBeginCommandBuffer(vkCommandBuffer, &beginInfo);
+	throwBeginCommandBufferFailed(result);
 
-		VkBuffer buffers[] = { vertexBuffer->getHandle() };
-		VkDeviceSize bufferOffsets[] = { 0 };
-		vkCmdBindVertexBuffers(vkCommandBuffers[i], 0, 1, buffers, bufferOffsets);
-		vkCmdBindIndexBuffer(vkCommandBuffers[i], indexBuffer->getHandle(), 0, VK_INDEX_TYPE_UINT32);
+	gpuProfiler->resetQueries(vkCommandBuffer, imageIndex);
 
-		vkCmdBindDescriptorSets(vkCommandBuffers[i], VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline->getLayoutHandle(),
-			0, 1, uniformBuffer->getDescriptorSetHandlePtr(i), 0, nullptr);
+	if (cullingPass)
+	{
+		gpuProfiler->beginRegion(vkCommandBuffer, imageIndex, "culling");
+		cullingPass->recordCulling(vkCommandBuffer, imageIndex, objects);
+		gpuProfiler->endRegion(vkCommandBuffer, imageIndex, "culling");
+	}
+
+	gpuProfiler->beginRegion(vkCommandBuffer, imageIndex, "render pass");
+
+	VkRenderPassBeginInfo renderPassInfo = {};
+	renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+	renderPassInfo.renderPass = renderPass->getHandle();
+	renderPassInfo.framebuffer = frameBuffer->getHandle(imageIndex);
+	renderPassInfo.renderArea.offset = { 0, 0 };
+	renderPassInfo.renderArea.extent = swapChain->getSwapChainExtent();
+
+	std::array<VkClearValue, 2> clearValues;
+	clearValues[0] = { 0.0f, 0.0f, 0.0f, 1.0f };
+	clearValues[1] = { 1.0f, 0 };
+
+	renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
+	renderPassInfo.pClearValues = clearValues.data();
+
+	// The profiler is not thread-safe and a subpass recorded as secondaries cannot write timestamps from the
+	// primary, so the parallel path only reports the render pass region.
+	if (workerPool)
+	{
+		workerPool->run(activeWorkerCount, [this, slot, imageIndex](uint32_t workerIndex)
+		{
+			recordSecondaryCommandBuffer(slot, imageIndex, workerIndex);
+		});
 
-		vkCmdDrawIndexed(vkCommandBuffers[i], static_cast<uint32_t>(indexBuffer->getIndicesCount()), 1, 0, 0, 0);
-		vkCmdEndRenderPass(vkCommandBuffers[i]);
+		vkCmdBeginRenderPass(vkCommandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+		vkCmdExecuteCommands(vkCommandBuffer, activeWorkerCount, vkSecondaryCommandBuffers[slot].data());
+	}
+	else
+	{
+		vkCmdBeginRenderPass(vkCommandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+		bindDrawState(vkCommandBuffer, imageIndex);
 
-		result = vkEndCommandBuffer(vkCommandBuffers[i]);
-		throwEndCommandBufferFailed(result);
+		gpuProfiler->beginRegion(vkCommandBuffer, imageIndex, "draw");
+		recordDraws(vkCommandBuffer, imageIndex, 0, static_cast<uint32_t>(objects.size()));
+		gpuProfiler->endRegion(vkCommandBuffer, imageIndex, "draw");
 	}
+
+	vkCmdEndRenderPass(vkCommandBuffer);
+
+	gpuProfiler->endRegion(vkCommandBuffer, imageIndex, "render pass");
+
+	result = vkEndCommandBuffer(vkCommandBuffer);
+	throwEndCommandBufferFailed(result);
 }
 
-VkCommandBufferAllocateInfo CommandBuffer::buildCommandBufferAllocateInfo(std::shared_ptr<CommandPool> commandPool)
+void CommandBuffer::recordSecondaryCommandBuffer(uint32_t slot, uint32_t imageIndex, uint32_t workerIndex)
+{
+	VkCommandBuffer vkCommandBuffer = vkSecondaryCommandBuffers[slot][workerIndex];
+	VkCommandBufferInheritanceInfo inheritanceInfo = buildInheritanceInfo(imageIndex);
+
+	VkCommandBufferBeginInfo beginInfo = {};
+	beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	beginInfo.flags = getCommandBufferUsageFlags() | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+	beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+	VkResult result = vkBeginCommandBuffer(vkCommandBuffer, &beginInfo);
+	throwBeginCommandBufferFailed(result);
+
+	uint32_t objectCount = static_cast<uint32_t>(objects.size());
+	uint32_t objectsPerWorker = (objectCount + activeWorkerCount - 1) / activeWorkerCount;
+	uint32_t firstObject = std::min(workerIndex * objectsPerWorker, objectCount);
+	uint32_t endObject = std::min(firstObject + objectsPerWorker, objectCount);
+
+	bindDrawState(vkCommandBuffer, imageIndex);
+	recordDraws(vkCommandBuffer, imageIndex, firstObject, endObject);
+
+	result = vkEndCommandBuffer(vkCommandBuffer);
+	throwEndCommandBufferFailed(result);
+}
+
+void CommandBuffer::bindDrawState(VkCommandBuffer vkCommandBuffer, uint32_t imageIndex)
+{
+	vkCmdBindPipeline(vkCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline->getHandle());
+
+	VkViewport viewport = buildViewport(swapChain);
+	VkRect2D scissor = buildScissor(swapChain);
+	vkCmdSetViewport(vkCommandBuffer, 0, 1, &viewport);
+	vkCmdSetScissor(vkCommandBuffer, 0, 1, &scissor);
+
+	VkBuffer buffers[] = { vertexBuffer->getHandle(), instanceBuffer->getHandle() };
+	VkDeviceSize bufferOffsets[] = { 0, instanceBuffer->getInstanceOffset(imageIndex) };
+	vkCmdBindVertexBuffers(vkCommandBuffer, 0, 2, buffers, bufferOffsets);
+	vkCmdBindIndexBuffer(vkCommandBuffer, indexBuffer->getHandle(), 0, VK_INDEX_TYPE_UINT32);
+
+	uint32_t dynamicOffset = uniformBuffer->getDynamicOffset(imageIndex);
+	vkCmdBindDescriptorSets(vkCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline->getLayoutHandle(),
+		0, 1, uniformBuffer->getDescriptorSetHandlePtr(), 1, &dynamicOffset);
+}
+
+void CommandBuffer::recordDraws(VkCommandBuffer vkCommandBuffer, uint32_t imageIndex, uint32_t firstObject,
+	uint32_t endObject)
+{
+	for (uint32_t objectIndex = firstObject; objectIndex < endObject; ++objectIndex)
+	{
+		vkCmdPushConstants(vkCommandBuffer, graphicsPipeline->getLayoutHandle(), VK_SHADER_STAGE_VERTEX_BIT,
+			0, sizeof(ObjectPushConstants), &objects[objectIndex]);
+
+		if (cullingPass)
+		{
+			VkBuffer visibleBuffer = cullingPass->getVisibleInstanceHandle();
+			VkDeviceSize visibleOffset = cullingPass->getVisibleInstanceOffset(imageIndex, objectIndex);
+			vkCmdBindVertexBuffers(vkCommandBuffer, 1, 1, &visibleBuffer, &visibleOffset);
+			cullingPass->recordDraw(vkCommandBuffer, imageIndex, objectIndex);
+		}
+		else if (instanceBuffer->hasVisibleObjects())
+		{
+			VkBuffer instanceHandle = instanceBuffer->getHandle();
+			VkDeviceSize visibleOffset = instanceBuffer->getVisibleInstanceOffset(imageIndex, objectIndex);
+			vkCmdBindVertexBuffers(vkCommandBuffer, 1, 1, &instanceHandle, &visibleOffset);
+			vkCmdDrawIndexedIndirect(vkCommandBuffer, instanceHandle,
+				instanceBuffer->getVisibleCommandOffset(imageIndex, objectIndex), 1, sizeof(VkDrawIndexedIndirectCommand));
+		}
+		else
+		{
+			vkCmdDrawIndexedIndirect(vkCommandBuffer, instanceBuffer->getHandle(),
+				instanceBuffer->getIndirectCommandOffset(imageIndex), 1, sizeof(VkDrawIndexedIndirectCommand));
+		}
+	}
+}
+
+VkViewport CommandBuffer::buildViewport(std::shared_ptr<SwapChain> swapChain) const
+{
+	VkViewport viewport = {};
+	viewport.x = 0.0f;
+	viewport.y = 0.0f;
+	viewport.width = static_cast<float>(swapChain->getSwapChainExtent().width);
+	viewport.height = static_cast<float>(swapChain->getSwapChainExtent().height);
+	viewport.minDepth = 0.0f;
+	viewport.maxDepth = 1.0f;
+
+	return viewport;
+}
+
+VkRect2D CommandBuffer::buildScissor(std::shared_ptr<SwapChain> swapChain) const
+{
+	VkRect2D scissor = {};
+	scissor.extent = swapChain->getSwapChainExtent();
+	scissor.offset = { 0, 0 };
+
+	return scissor;
+}
+
+CommandBuffer::~CommandBuffer()
+{
+	for (size_t slot = 0; slot < vkCommandBuffers.size(); ++slot)
+	{
+		vkFreeCommandBuffers(device->getHandle(), slotCommandPools[slot]->getHandle(), 1, &vkCommandBuffers[slot]);
+	}
+
+	for (size_t i = 0; i < vkSecondaryCommandBuffers.size(); ++i)
+	{
+		for (size_t workerIndex = 0; workerIndex < vkSecondaryCommandBuffers[i].size(); ++workerIndex)
+		{
+			vkFreeCommandBuffers(device->getHandle(), secondaryCommandPools[i][workerIndex]->getHandle(), 1,
+				&vkSecondaryCommandBuffers[i][workerIndex]);
+		}
+	}
+}
+
+VkCommandBufferAllocateInfo CommandBuffer::buildCommandBufferAllocateInfo(VkCommandPool vkCommandPool,
+	VkCommandBufferLevel level, uint32_t count) const
 {
 	VkCommandBufferAllocateInfo commandBufferInfo = {};
 	commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-	commandBufferInfo.commandPool = commandPool->getHandle();
-	commandBufferInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-	commandBufferInfo.commandBufferCount = static_cast<uint32_t>(vkCommandBuffers.size());
+	commandBufferInfo.commandPool = vkCommandPool;
+	commandBufferInfo.level = level;
+	commandBufferInfo.commandBufferCount = count;
 
 	return commandBufferInfo;
 }
 
+VkCommandBufferInheritanceInfo CommandBuffer::buildInheritanceInfo(uint32_t index) const
+{
+	VkCommandBufferInheritanceInfo inheritanceInfo = {};
+	inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+	inheritanceInfo.renderPass = renderPass->getHandle();
+	inheritanceInfo.subpass = 0;
+	inheritanceInfo.framebuffer = frameBuffer->getHandle(index);
+
+	return inheritanceInfo;
+}
+
 
 void CommandBuffer::throwEndCommandBufferFailed(VkResult result)
 {
@@ -101,7 +371,22 @@ void CommandBuffer::throwAllocateCommandBufferFailed(VkResult result)
 	}
 }
 
-VkCommandBuffer* CommandBuffer::getHandlePtr(uint32_t index)
+VkCommandBuffer* CommandBuffer::getHandlePtr(uint32_t frameIndex, uint32_t imageIndex)
+{
+	return &vkCommandBuffers[recordingMode == CommandRecordingMode::PerFrame ? frameIndex : imageIndex];
+}
+
+uint32_t CommandBuffer::getActiveWorkerCount() const
+{
+	return workerPool ? activeWorkerCount : 1;
+}
+
+FrameStats CommandBuffer::getRecordingStats() const
+{
+	return recordingTimer.getStats();
+}
+
+void CommandBuffer::resetRecordingStats()
 {
-	return &vkCommandBuffers[index];
+	recordingTimer.reset();
 }
\ No newline at end of file
@@ -3,6 +3,9 @@
 #include <vulkan.h>
 #include <vector>
 #include <memory>
+#include "ObjectPushConstants.h"
+#include "CommandRecordingMode.h"
+#include "FrameTimer.h"
 
 class Device;
 class RenderPass;
@@ -12,26 +15,74 @@ class CommandPool;
 class VertexBuffer;
 class GraphicsPipeline;
 class IndexBuffer;
+class InstanceBuffer;
+class CullingPass;
 class UniformBuffer;
+class GpuProfiler;
+class WorkerPool;
 
 
 class CommandBuffer
 {
 private:
+	std::shared_ptr<Device> device;
+	std::shared_ptr<CommandPool> commandPool;
+	std::shared_ptr<RenderPass> renderPass;
+	std::shared_ptr<Framebuffer> frameBuffer;
+	std::shared_ptr<SwapChain> swapChain;
+	std::shared_ptr<GraphicsPipeline> graphicsPipeline;
+	std::shared_ptr<VertexBuffer> vertexBuffer;
+	std::shared_ptr<IndexBuffer> indexBuffer;
+	std::shared_ptr<InstanceBuffer> instanceBuffer;
+	std::shared_ptr<CullingPass> cullingPass;
+	std::shared_ptr<UniformBuffer> uniformBuffer;
+	std::shared_ptr<GpuProfiler> gpuProfiler;
+	std::vector<ObjectPushConstants> objects;
 	std::vector<VkCommandBuffer> vkCommandBuffers;
+	CommandRecordingMode recordingMode;
+	std::vector<std::shared_ptr<CommandPool>> slotCommandPools;
+	FrameTimer recordingTimer;
+
+	std::shared_ptr<WorkerPool> workerPool;
+	uint32_t activeWorkerCount;
+	std::vector<std::vector<std::shared_ptr<CommandPool>>> secondaryCommandPools;
+	std::vector<std::vector<VkCommandBuffer>> vkSecondaryCommandBuffers;
 
 	void throwEndCommandBufferFailed(VkResult result);
 	void throwBeginCommandBufferFailed(VkResult result);
 	void throwAllocateCommandBufferFailed(VkResult result);
 
-	VkCommandBufferAllocateInfo buildCommandBufferAllocateInfo(std::shared_ptr<CommandPool> commandPool);
+	VkCommandBufferAllocateInfo buildCommandBufferAllocateInfo(VkCommandPool vkCommandPool, VkCommandBufferLevel level,
+		uint32_t count) const;
+
+	VkCommandBufferInheritanceInfo buildInheritanceInfo(uint32_t index) const;
+	VkViewport buildViewport(std::shared_ptr<SwapChain> swapChain) const;
+	VkRect2D buildScissor(std::shared_ptr<SwapChain> swapChain) const;
+
+	void createPrimaryCommandBuffers(uint32_t slotCount);
+	void createSecondaryCommandBuffers(uint32_t recordingWorkerCount);
+	VkCommandPoolCreateFlags getCommandPoolFlags() const;
+	VkCommandBufferUsageFlags getCommandBufferUsageFlags() const;
+	void recordCommandBuffer(uint32_t slot, uint32_t imageIndex);
+	void recordSecondaryCommandBuffer(uint32_t slot, uint32_t imageIndex, uint32_t workerIndex);
+	void bindDrawState(VkCommandBuffer vkCommandBuffer, uint32_t imageIndex);
+	void recordDraws(VkCommandBuffer vkCommandBuffer, uint32_t imageIndex, uint32_t firstObject, uint32_t endObject);
 
 public:
 	CommandBuffer(std::shared_ptr<Device> device, std::shared_ptr<RenderPass> renderPass,
 		std::shared_ptr<Framebuffer> frameBuffer, std::shared_ptr<CommandPool> commandPool,
 		std::shared_ptr<SwapChain> swapChain, std::shared_ptr<GraphicsPipeline> graphicsPipeline,
 		std::shared_ptr<VertexBuffer> vertexBuffer, std::shared_ptr<IndexBuffer> indexBuffer,
-		std::shared_ptr<UniformBuffer> uniformBuffer);
+		std::shared_ptr<InstanceBuffer> instanceBuffer, std::shared_ptr<CullingPass> cullingPass,
+		std::shared_ptr<UniformBuffer> uniformBuffer, std::shared_ptr<GpuProfiler> gpuProfiler,
+		const std::vector<ObjectPushConstants>& objects, uint32_t recordingWorkerCount,
+		CommandRecordingMode recordingMode, uint32_t frameSlotCount);
+
+	~CommandBuffer();
 
-	VkCommandBuffer* getHandlePtr(uint32_t index);
-};
\ No newline at end of file
+	void recordFrame(uint32_t slot, uint32_t imageIndex, const std::vector<ObjectPushConstants>& objects);
+	VkCommandBuffer* getHandlePtr(uint32_t frameIndex, uint32_t imageIndex);
+	uint32_t getActiveWorkerCount() const;
+	FrameStats getRecordingStats() const;
+	void resetRecordingStats();
+};
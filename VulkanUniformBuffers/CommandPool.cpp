@@ -5,10 +5,21 @@
 
 
 CommandPool::CommandPool(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device)
+	: CommandPool(device, physicalDevice->getQueueFamilyIndices().graphics.value())
+{
+}
+
+CommandPool::CommandPool(std::shared_ptr<Device> device, uint32_t queueFamilyIndex)
+	: CommandPool(device, queueFamilyIndex, 0)
+{
+}
+
+CommandPool::CommandPool(std::shared_ptr<Device> device, uint32_t queueFamilyIndex, VkCommandPoolCreateFlags flags)
 {
 	this->device = device;
+	this->queueFamilyIndex = queueFamilyIndex;
 
-	VkCommandPoolCreateInfo commandPoolCreateInfo = buildCommandPoolCreateInfo(physicalDevice);
+	VkCommandPoolCreateInfo commandPoolCreateInfo = buildCommandPoolCreateInfo(queueFamilyIndex, flags);
 	VkResult result = createCommandPool(device, &commandPoolCreateInfo);
 	throwIfCreationFailed(result);
 }
@@ -18,13 +29,20 @@ CommandPool::~CommandPool()
 	vkDestroyCommandPool(device->getHandle(), vkCommandPool, nullptr);
 }
 
-VkCommandPoolCreateInfo CommandPool::buildCommandPoolCreateInfo(std::shared_ptr<PhysicalDevice> physicalDevice)
+// Recycles every buffer allocated from the pool in one call, so the pool needs no RESET_COMMAND_BUFFER_BIT.
+void CommandPool::reset()
 {
-	QueueFamilyIndices queueFamilyIndices = physicalDevice->getQueueFamilyIndices();
+	VkResult result = vkResetCommandPool(device->getHandle(), vkCommandPool, 0);
+	throwIfResetFailed(result);
+}
 
+VkCommandPoolCreateInfo CommandPool::buildCommandPoolCreateInfo(uint32_t queueFamilyIndex,
+	VkCommandPoolCreateFlags flags)
+{
 	VkCommandPoolCreateInfo createInfo = {};
 	createInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-	createInfo.queueFamilyIndex = queueFamilyIndices.graphics.value();
+	createInfo.flags = flags;
+	createInfo.queueFamilyIndex = queueFamilyIndex;
 
 	return createInfo;
 }
@@ -42,7 +60,20 @@ void CommandPool::throwIfCreationFailed(VkResult result)
 	}
 }
 
+void CommandPool::throwIfResetFailed(VkResult result)
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to reset command pool.");
+	}
+}
+
 VkCommandPool CommandPool::getHandle() const
 {
 	return vkCommandPool;
+}
+
+uint32_t CommandPool::getQueueFamilyIndex() const
+{
+	return queueFamilyIndex;
 }
\ No newline at end of file
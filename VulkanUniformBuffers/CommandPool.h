@@ -13,14 +13,21 @@ class CommandPool
 private:
 	std::shared_ptr<Device> device;
 	VkCommandPool vkCommandPool;
+	uint32_t queueFamilyIndex;
 
-	VkCommandPoolCreateInfo buildCommandPoolCreateInfo(std::shared_ptr<PhysicalDevice> physicalDevice);
+	VkCommandPoolCreateInfo buildCommandPoolCreateInfo(uint32_t queueFamilyIndex, VkCommandPoolCreateFlags flags);
 	VkResult createCommandPool(std::shared_ptr<Device> device, VkCommandPoolCreateInfo* createInfo);
 	void throwIfCreationFailed(VkResult result);
+	void throwIfResetFailed(VkResult result);
 
 public:
 	CommandPool(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device);
+	CommandPool(std::shared_ptr<Device> device, uint32_t queueFamilyIndex);
+	CommandPool(std::shared_ptr<Device> device, uint32_t queueFamilyIndex, VkCommandPoolCreateFlags flags);
 	~CommandPool();
 
+	void reset();
+
 	VkCommandPool getHandle() const;
+	uint32_t getQueueFamilyIndex() const;
 };
\ No newline at end of file
@@ -0,0 +1,7 @@
+#pragma once
+
+enum class CommandRecordingMode
+{
+	Prerecorded,
+	PerFrame
+};
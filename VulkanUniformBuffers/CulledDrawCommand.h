@@ -0,0 +1,10 @@
+#pragma once
+
+#include <vulkan.h>
+
+
+struct CulledDrawCommand
+{
+	VkDrawIndexedIndirectCommand command;
+	uint32_t drawCount;
+};
@@ -0,0 +1,158 @@
+#include "CullingBenchmark.h"
+#include "FrustumCuller.h"
+#include "CullingKernels.h"
+#include "FrameTimer.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <chrono>
+#include <random>
+
+
+CullingBenchmark::CullingBenchmark(uint32_t iterationCount)
+{
+	this->iterationCount = iterationCount;
+
+	viewProjection = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, SCENE_EXTENT)
+		* glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+}
+
+std::vector<CullingBenchmarkResult> CullingBenchmark::runAll(const std::vector<uint32_t>& objectCounts,
+	uint32_t workerCount)
+{
+	CullingKernel bestKernel = detectCullingKernel();
+	std::vector<CullingBenchmarkResult> results;
+
+	for (uint32_t objectCount : objectCounts)
+	{
+		InstanceBounds bounds;
+		std::vector<glm::vec4> spheres;
+		generateScene(objectCount, &bounds, &spheres);
+
+		results.push_back(runGlmBaseline(spheres));
+		results.push_back(runCuller(CullingKernel::Scalar, 1, bounds));
+		results.push_back(runCuller(CullingKernel::Sse, 1, bounds));
+
+		if (bestKernel == CullingKernel::Avx2)
+		{
+			results.push_back(runCuller(CullingKernel::Avx2, 1, bounds));
+		}
+
+		if (workerCount > 1)
+		{
+			results.push_back(runCuller(bestKernel, workerCount, bounds));
+		}
+	}
+
+	return results;
+}
+
+// Spheres fill a cube around the camera, so roughly one in twenty lands inside the frustum.
+void CullingBenchmark::generateScene(uint32_t objectCount, InstanceBounds* bounds,
+	std::vector<glm::vec4>* spheres) const
+{
+	std::mt19937 generator(SCENE_SEED);
+	std::uniform_real_distribution<float> position(-SCENE_EXTENT, SCENE_EXTENT);
+	std::uniform_real_distribution<float> radius(0.5f, 2.0f);
+
+	for (uint32_t i = 0; i < objectCount; ++i)
+	{
+		glm::vec4 sphere(position(generator), position(generator), position(generator), radius(generator));
+
+		bounds->centerX.push_back(sphere.x);
+		bounds->centerY.push_back(sphere.y);
+		bounds->centerZ.push_back(sphere.z);
+		bounds->radius.push_back(sphere.w);
+		spheres->push_back(sphere);
+	}
+}
+
+// The baseline is the straightforward array-of-structures loop with glm vector maths.
+CullingBenchmarkResult CullingBenchmark::runGlmBaseline(const std::vector<glm::vec4>& spheres) const
+{
+	using namespace std::chrono;
+
+	FrustumPlanes extracted = FrustumCuller::extractPlanes(viewProjection);
+	glm::vec4 planes[6];
+
+	for (int p = 0; p < 6; ++p)
+	{
+		planes[p] = glm::vec4(extracted.x[p], extracted.y[p], extracted.z[p], extracted.w[p]);
+	}
+
+	FrameTimer timer;
+	std::vector<uint32_t> visible;
+	visible.reserve(spheres.size());
+
+	for (uint32_t iteration = 0; iteration < WARM_UP_ITERATION_COUNT + iterationCount; ++iteration)
+	{
+		high_resolution_clock::time_point start = high_resolution_clock::now();
+
+		visible.clear();
+
+		for (uint32_t i = 0; i < spheres.size(); ++i)
+		{
+			glm::vec3 center(spheres[i]);
+			bool inside = true;
+
+			for (int p = 0; p < 6 && inside; ++p)
+			{
+				inside = glm::dot(glm::vec3(planes[p]), center) + planes[p].w >= -spheres[i].w;
+			}
+
+			if (inside)
+			{
+				visible.push_back(i);
+			}
+		}
+
+		high_resolution_clock::time_point end = high_resolution_clock::now();
+
+		if (iteration >= WARM_UP_ITERATION_COUNT)
+		{
+			timer.addSample(duration<double, std::milli>(end - start).count());
+		}
+	}
+
+	CullingBenchmarkResult result = {};
+	result.kernelName = "glm";
+	result.objectCount = static_cast<uint32_t>(spheres.size());
+	result.workerCount = 1;
+	result.visibleCount = static_cast<uint32_t>(visible.size());
+	result.stats = timer.getStats();
+
+	return result;
+}
+
+CullingBenchmarkResult CullingBenchmark::runCuller(CullingKernel kernel, uint32_t workerCount,
+	const InstanceBounds& bounds) const
+{
+	using namespace std::chrono;
+
+	FrustumCuller frustumCuller(workerCount);
+	frustumCuller.setKernel(kernel);
+
+	FrameTimer timer;
+
+	for (uint32_t iteration = 0; iteration < WARM_UP_ITERATION_COUNT + iterationCount; ++iteration)
+	{
+		high_resolution_clock::time_point start = high_resolution_clock::now();
+
+		frustumCuller.cull(viewProjection, bounds);
+
+		high_resolution_clock::time_point end = high_resolution_clock::now();
+
+		if (iteration >= WARM_UP_ITERATION_COUNT)
+		{
+			timer.addSample(duration<double, std::milli>(end - start).count());
+		}
+	}
+
+	CullingBenchmarkResult result = {};
+	result.kernelName = FrustumCuller::getKernelName(kernel);
+	result.objectCount = static_cast<uint32_t>(bounds.radius.size());
+	result.workerCount = frustumCuller.getWorkerCount();
+	result.visibleCount = frustumCuller.getVisibleCount();
+	result.stats = timer.getStats();
+
+	return result;
+}
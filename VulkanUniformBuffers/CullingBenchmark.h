@@ -0,0 +1,33 @@
+#pragma once
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+
+#include <cstdint>
+#include <vector>
+#include "glm/mat4x4.hpp"
+#include "glm/vec4.hpp"
+#include "InstanceBounds.h"
+#include "CullingKernel.h"
+#include "CullingBenchmarkResult.h"
+
+
+class CullingBenchmark
+{
+private:
+	const uint32_t WARM_UP_ITERATION_COUNT = 10;
+	const uint32_t SCENE_SEED = 1234;
+	const float SCENE_EXTENT = 100.0f;
+
+	uint32_t iterationCount;
+	glm::mat4 viewProjection;
+
+	void generateScene(uint32_t objectCount, InstanceBounds* bounds, std::vector<glm::vec4>* spheres) const;
+	CullingBenchmarkResult runGlmBaseline(const std::vector<glm::vec4>& spheres) const;
+	CullingBenchmarkResult runCuller(CullingKernel kernel, uint32_t workerCount, const InstanceBounds& bounds) const;
+
+public:
+	CullingBenchmark(uint32_t iterationCount);
+
+	std::vector<CullingBenchmarkResult> runAll(const std::vector<uint32_t>& objectCounts, uint32_t workerCount);
+};
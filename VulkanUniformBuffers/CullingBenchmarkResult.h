@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+#include "FrameStats.h"
+
+
+struct CullingBenchmarkResult
+{
+	const char* kernelName;
+	uint32_t objectCount;
+	uint32_t workerCount;
+	uint32_t visibleCount;
+	FrameStats stats;
+};
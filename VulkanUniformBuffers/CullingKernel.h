@@ -0,0 +1,8 @@
+#pragma once
+
+enum class CullingKernel
+{
+	Scalar,
+	Sse,
+	Avx2
+};
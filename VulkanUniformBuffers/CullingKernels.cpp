@@ -0,0 +1,153 @@
+#include "CullingKernels.h"
+#include "CullingKernelsAvx2.h"
+#include <immintrin.h>
+#include <algorithm>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+
+// AVX2 also needs the OS to save the YMM registers, which XGETBV reports.
+CullingKernel detectCullingKernel()
+{
+#ifdef _MSC_VER
+	int cpuInfo[4];
+	__cpuid(cpuInfo, 0);
+	int maxLeaf = cpuInfo[0];
+
+	__cpuid(cpuInfo, 1);
+	bool osXsave = (cpuInfo[2] & (1 << 27)) != 0;
+	bool avx = (cpuInfo[2] & (1 << 28)) != 0;
+
+	if (maxLeaf >= 7 && osXsave && avx && (_xgetbv(0) & 0x6) == 0x6)
+	{
+		__cpuidex(cpuInfo, 7, 0);
+
+		if ((cpuInfo[1] & (1 << 5)) != 0)
+		{
+			return CullingKernel::Avx2;
+		}
+	}
+#else
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx2"))
+	{
+		return CullingKernel::Avx2;
+	}
+#endif
+
+	return CullingKernel::Sse;
+}
+
+void cullSpheresScalar(const FrustumPlanes& planes, const InstanceBounds& bounds, uint32_t begin, uint32_t end,
+	std::vector<uint32_t>* visible)
+{
+	for (uint32_t i = begin; i < end; ++i)
+	{
+		bool inside = true;
+
+		for (int p = 0; p < 6 && inside; ++p)
+		{
+			float distance = planes.x[p] * bounds.centerX[i] + planes.y[p] * bounds.centerY[i]
+				+ planes.z[p] * bounds.centerZ[i] + planes.w[p];
+
+			inside = distance >= -bounds.radius[i];
+		}
+
+		if (inside)
+		{
+			visible->push_back(i);
+		}
+	}
+}
+
+// Eight spheres per iteration as two SSE halves, so the loop shape matches the AVX2 kernel.
+void cullSpheresSse(const FrustumPlanes& planes, const InstanceBounds& bounds, uint32_t begin, uint32_t end,
+	std::vector<uint32_t>* visible)
+{
+	__m128 planeX[6];
+	__m128 planeY[6];
+	__m128 planeZ[6];
+	__m128 planeW[6];
+
+	for (int p = 0; p < 6; ++p)
+	{
+		planeX[p] = _mm_set1_ps(planes.x[p]);
+		planeY[p] = _mm_set1_ps(planes.y[p]);
+		planeZ[p] = _mm_set1_ps(planes.z[p]);
+		planeW[p] = _mm_set1_ps(planes.w[p]);
+	}
+
+	const __m128 zero = _mm_setzero_ps();
+	uint32_t i = begin;
+
+	for (; i + 8 <= end; i += 8)
+	{
+		uint32_t mask = 0;
+
+		for (uint32_t half = 0; half < 8; half += 4)
+		{
+			__m128 x = _mm_loadu_ps(&bounds.centerX[i + half]);
+			__m128 y = _mm_loadu_ps(&bounds.centerY[i + half]);
+			__m128 z = _mm_loadu_ps(&bounds.centerZ[i + half]);
+			__m128 negativeRadius = _mm_sub_ps(zero, _mm_loadu_ps(&bounds.radius[i + half]));
+			__m128 inside = _mm_cmpeq_ps(zero, zero);
+
+			for (int p = 0; p < 6; ++p)
+			{
+				__m128 distance = _mm_add_ps(
+					_mm_add_ps(_mm_mul_ps(planeX[p], x), _mm_mul_ps(planeY[p], y)),
+					_mm_add_ps(_mm_mul_ps(planeZ[p], z), planeW[p]));
+
+				inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, negativeRadius));
+			}
+
+			mask |= static_cast<uint32_t>(_mm_movemask_ps(inside)) << half;
+		}
+
+		appendVisibleMask(i, mask, visible);
+	}
+
+	cullSpheresScalar(planes, bounds, i, end, visible);
+}
+
+// The AVX2 kernel only fills a stack buffer of masks; appending to the vector stays in this baseline-ISA file.
+void cullSpheresAvx2(const FrustumPlanes& planes, const InstanceBounds& bounds, uint32_t begin, uint32_t end,
+	std::vector<uint32_t>* visible)
+{
+	const uint32_t MAX_BLOCK_COUNT = 256;
+	uint8_t masks[MAX_BLOCK_COUNT];
+	uint32_t i = begin;
+
+	while (i + 8 <= end)
+	{
+		uint32_t blockCount = std::min((end - i) / 8, MAX_BLOCK_COUNT);
+
+		computeVisibleMasksAvx2(planes, bounds.centerX.data() + i, bounds.centerY.data() + i,
+			bounds.centerZ.data() + i, bounds.radius.data() + i, blockCount, masks);
+
+		for (uint32_t block = 0; block < blockCount; ++block, i += 8)
+		{
+			appendVisibleMask(i, masks[block], visible);
+		}
+	}
+
+	cullSpheresScalar(planes, bounds, i, end, visible);
+}
+
+void appendVisibleMask(uint32_t first, uint32_t mask, std::vector<uint32_t>* visible)
+{
+	while (mask != 0)
+	{
+#ifdef _MSC_VER
+		unsigned long bit;
+		_BitScanForward(&bit, mask);
+#else
+		uint32_t bit = static_cast<uint32_t>(__builtin_ctz(mask));
+#endif
+		visible->push_back(first + bit);
+		mask &= mask - 1;
+	}
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "FrustumPlanes.h"
+#include "InstanceBounds.h"
+#include "CullingKernel.h"
+
+
+CullingKernel detectCullingKernel();
+
+void cullSpheresScalar(const FrustumPlanes& planes, const InstanceBounds& bounds, uint32_t begin, uint32_t end,
+	std::vector<uint32_t>* visible);
+
+void cullSpheresSse(const FrustumPlanes& planes, const InstanceBounds& bounds, uint32_t begin, uint32_t end,
+	std::vector<uint32_t>* visible);
+
+void cullSpheresAvx2(const FrustumPlanes& planes, const InstanceBounds& bounds, uint32_t begin, uint32_t end,
+	std::vector<uint32_t>* visible);
+
+void appendVisibleMask(uint32_t first, uint32_t mask, std::vector<uint32_t>* visible);
@@ -0,0 +1,50 @@
+#include "CullingKernelsAvx2.h"
+#include <immintrin.h>
+
+// MSVC builds this file with /arch:AVX2; the pragma gives other compilers the same per-file target.
+#ifndef _MSC_VER
+#pragma GCC target("avx2")
+#endif
+
+
+// Writes one visibility bit per sphere, eight spheres to a mask.
+void computeVisibleMasksAvx2(const FrustumPlanes& planes, const float* centerX, const float* centerY,
+	const float* centerZ, const float* radius, uint32_t blockCount, uint8_t* masks)
+{
+	__m256 planeX[6];
+	__m256 planeY[6];
+	__m256 planeZ[6];
+	__m256 planeW[6];
+
+	for (int p = 0; p < 6; ++p)
+	{
+		planeX[p] = _mm256_set1_ps(planes.x[p]);
+		planeY[p] = _mm256_set1_ps(planes.y[p]);
+		planeZ[p] = _mm256_set1_ps(planes.z[p]);
+		planeW[p] = _mm256_set1_ps(planes.w[p]);
+	}
+
+	const __m256 zero = _mm256_setzero_ps();
+	const __m256 allLanes = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+	for (uint32_t block = 0; block < blockCount; ++block)
+	{
+		uint32_t i = block * 8;
+		__m256 x = _mm256_loadu_ps(centerX + i);
+		__m256 y = _mm256_loadu_ps(centerY + i);
+		__m256 z = _mm256_loadu_ps(centerZ + i);
+		__m256 negativeRadius = _mm256_sub_ps(zero, _mm256_loadu_ps(radius + i));
+		__m256 inside = allLanes;
+
+		for (int p = 0; p < 6; ++p)
+		{
+			__m256 distance = _mm256_add_ps(
+				_mm256_add_ps(_mm256_mul_ps(planeX[p], x), _mm256_mul_ps(planeY[p], y)),
+				_mm256_add_ps(_mm256_mul_ps(planeZ[p], z), planeW[p]));
+
+			inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, negativeRadius, _CMP_GE_OQ));
+		}
+
+		masks[block] = static_cast<uint8_t>(_mm256_movemask_ps(inside));
+	}
+}
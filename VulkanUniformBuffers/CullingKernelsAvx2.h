@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstdint>
+#include "FrustumPlanes.h"
+
+// Built with AVX2 code generation, so this interface takes raw pointers only: any inline or template code shared
+// with the rest of the program could be folded into an AVX2 copy by the linker.
+void computeVisibleMasksAvx2(const FrustumPlanes& planes, const float* centerX, const float* centerY,
+	const float* centerZ, const float* radius, uint32_t blockCount, uint8_t* masks);
@@ -0,0 +1,8 @@
+#pragma once
+
+enum class CullingMode
+{
+	Off,
+	Cpu,
+	Gpu
+};
@@ -0,0 +1,284 @@
+#include "CullingPass.h"
+#include "PhysicalDevice.h"
+#include "Device.h"
+#include "CullingPipeline.h"
+#include "InstanceBuffer.h"
+#include "UniformBuffer.h"
+#include "CullingPushConstants.h"
+#include "CulledDrawCommand.h"
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
+
+
+CullingPass::CullingPass(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
+	std::shared_ptr<MemoryAllocator> memoryAllocator, std::shared_ptr<CullingPipeline> cullingPipeline,
+	std::shared_ptr<InstanceBuffer> instanceBuffer, std::shared_ptr<UniformBuffer> uniformBuffer,
+	uint32_t frameCount, uint32_t objectCount, float meshRadius)
+	: Buffer(physicalDevice, device, memoryAllocator)
+{
+	this->cullingPipeline = cullingPipeline;
+	this->instanceBuffer = instanceBuffer;
+	this->uniformBuffer = uniformBuffer;
+	this->frameCount = frameCount;
+	this->objectCount = objectCount;
+	this->meshRadius = meshRadius;
+
+	// Sized for twice the live instances so a growing scene does not rebuild the pass every frame.
+	visibleCapacity = std::min(std::max(instanceBuffer->getInstanceCount() * 2, MIN_VISIBLE_CAPACITY),
+		instanceBuffer->getCapacity());
+	storageAlignment = physicalDevice->getProperties().limits.minStorageBufferOffsetAlignment;
+	visibleRegionSize = alignUp(sizeof(InstanceData) * visibleCapacity * objectCount);
+	commandRegionSize = alignUp(sizeof(CulledDrawCommand) * objectCount);
+	dispatchRegionSize = alignUp(sizeof(VkDispatchIndirectCommand));
+	throwIfVisibleRegionTooLarge();
+
+	createBuffers();
+	createDescriptorPool();
+	createDescriptorSets();
+	loadDrawIndirectCount();
+}
+
+CullingPass::~CullingPass()
+{
+	vkDestroyDescriptorPool(device->getHandle(), vkDescriptorPool, nullptr);
+	destroyBuffer(dispatchBuffer, dispatchAllocation);
+	destroyBuffer(drawCommandBuffer, drawCommandAllocation);
+	destroyBuffer(visibleInstanceBuffer, visibleInstanceAllocation);
+}
+
+// Each swapchain image owns one compacted visible-instance region and one array of per-object draw commands, so
+// the culling results of one frame never alias another frame that is still in flight. Scene object i appends its
+// visible instances from i * visibleCapacity onwards.
+void CullingPass::createBuffers()
+{
+	createBuffer(visibleRegionSize * frameCount, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+		VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &visibleInstanceBuffer,
+		&visibleInstanceAllocation);
+
+	createBuffer(commandRegionSize * frameCount, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+		VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+		&drawCommandBuffer, &drawCommandAllocation);
+
+	createHostVisibleBuffer(dispatchRegionSize * frameCount, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, &dispatchBuffer,
+		&dispatchAllocation);
+}
+
+void CullingPass::createDescriptorPool()
+{
+	VkDescriptorPoolSize poolSizes[2] = {};
+	poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+	poolSizes[0].descriptorCount = frameCount;
+	poolSizes[1].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	poolSizes[1].descriptorCount = frameCount * 4;
+
+	VkDescriptorPoolCreateInfo createInfo = {};
+	createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+	createInfo.poolSizeCount = 2;
+	createInfo.pPoolSizes = poolSizes;
+	createInfo.maxSets = frameCount;
+
+	VkResult result = vkCreateDescriptorPool(device->getHandle(), &createInfo, nullptr, &vkDescriptorPool);
+	throwIfCreateDescriptorPoolFailed(result);
+}
+
+void CullingPass::createDescriptorSets()
+{
+	descriptorSets.resize(frameCount);
+	std::vector<VkDescriptorSetLayout> layouts(descriptorSets.size(), cullingPipeline->getDescriptorSetLayoutHandle());
+
+	VkDescriptorSetAllocateInfo allocateInfo = {};
+	allocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+	allocateInfo.descriptorPool = vkDescriptorPool;
+	allocateInfo.descriptorSetCount = static_cast<uint32_t>(layouts.size());
+	allocateInfo.pSetLayouts = layouts.data();
+
+	VkResult result = vkAllocateDescriptorSets(device->getHandle(), &allocateInfo, descriptorSets.data());
+	throwIfAllocateDescriptorSetsFailed(result);
+
+	for (uint32_t frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+	{
+		writeDescriptorSet(frameIndex);
+	}
+}
+
+void CullingPass::writeDescriptorSet(uint32_t frameIndex)
+{
+	VkDescriptorBufferInfo bufferInfos[5] = {};
+
+	bufferInfos[0].buffer = uniformBuffer->getBufferHandle();
+	bufferInfos[0].offset = 0;
+	bufferInfos[0].range = sizeof(UniformBufferObject);
+
+	bufferInfos[1].buffer = instanceBuffer->getHandle();
+	bufferInfos[1].offset = instanceBuffer->getInstanceOffset(frameIndex);
+	bufferInfos[1].range = sizeof(InstanceData) * instanceBuffer->getCapacity();
+
+	bufferInfos[2].buffer = instanceBuffer->getHandle();
+	bufferInfos[2].offset = instanceBuffer->getIndirectCommandOffset(frameIndex);
+	bufferInfos[2].range = sizeof(VkDrawIndexedIndirectCommand);
+
+	bufferInfos[3].buffer = visibleInstanceBuffer;
+	bufferInfos[3].offset = getVisibleInstanceOffset(frameIndex, 0);
+	bufferInfos[3].range = sizeof(InstanceData) * visibleCapacity * objectCount;
+
+	bufferInfos[4].buffer = drawCommandBuffer;
+	bufferInfos[4].offset = getCommandOffset(frameIndex, 0);
+	bufferInfos[4].range = sizeof(CulledDrawCommand) * objectCount;
+
+	VkWriteDescriptorSet writes[5] = {};
+
+	for (uint32_t binding = 0; binding < 5; ++binding)
+	{
+		writes[binding].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		writes[binding].dstSet = descriptorSets[frameIndex];
+		writes[binding].dstBinding = binding;
+		writes[binding].descriptorCount = 1;
+		writes[binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		writes[binding].pBufferInfo = &bufferInfos[binding];
+	}
+
+	writes[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+
+	vkUpdateDescriptorSets(device->getHandle(), 5, writes, 0, nullptr);
+}
+
+void CullingPass::loadDrawIndirectCount()
+{
+	drawIndexedIndirectCount = nullptr;
+
+	if (physicalDevice->isDrawIndirectCountSupported())
+	{
+		drawIndexedIndirectCount = reinterpret_cast<PFN_vkCmdDrawIndexedIndirectCountKHR>(
+			vkGetDeviceProcAddr(device->getHandle(), "vkCmdDrawIndexedIndirectCountKHR"));
+	}
+}
+
+// The host writes the group count for the live instances every frame, so prerecorded command buffers dispatch
+// no more invocations than there are instances.
+void CullingPass::writeDispatch(uint32_t frameIndex, uint32_t instanceCount)
+{
+	VkDispatchIndirectCommand dispatchCommand = {};
+	dispatchCommand.x = (instanceCount + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE;
+	dispatchCommand.y = 1;
+	dispatchCommand.z = 1;
+
+	VkDeviceSize offset = dispatchRegionSize * frameIndex;
+	memcpy(static_cast<char*>(dispatchAllocation.mappedData) + offset, &dispatchCommand, sizeof(dispatchCommand));
+	flushHostVisibleBuffer(dispatchAllocation, offset, sizeof(dispatchCommand));
+}
+
+void CullingPass::recordCulling(VkCommandBuffer commandBuffer, uint32_t frameIndex,
+	const std::vector<ObjectPushConstants>& objects)
+{
+	vkCmdFillBuffer(commandBuffer, drawCommandBuffer, getCommandOffset(frameIndex, 0),
+		sizeof(CulledDrawCommand) * objectCount, 0);
+
+	VkMemoryBarrier clearBarrier = {};
+	clearBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+	clearBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	clearBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+
+	vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+		1, &clearBarrier, 0, nullptr, 0, nullptr);
+
+	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, cullingPipeline->getHandle());
+
+	uint32_t dynamicOffset = uniformBuffer->getDynamicOffset(frameIndex);
+	vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, cullingPipeline->getLayoutHandle(), 0, 1,
+		&descriptorSets[frameIndex], 1, &dynamicOffset);
+
+	for (uint32_t objectIndex = 0; objectIndex < objectCount; ++objectIndex)
+	{
+		CullingPushConstants pushConstants = {};
+		pushConstants.objectModel = objects[objectIndex].model;
+		pushConstants.meshRadius = meshRadius;
+		pushConstants.objectIndex = objectIndex;
+		pushConstants.visibleBase = visibleCapacity * objectIndex;
+
+		vkCmdPushConstants(commandBuffer, cullingPipeline->getLayoutHandle(), VK_SHADER_STAGE_COMPUTE_BIT, 0,
+			sizeof(CullingPushConstants), &pushConstants);
+		vkCmdDispatchIndirect(commandBuffer, dispatchBuffer, dispatchRegionSize * frameIndex);
+	}
+
+	VkMemoryBarrier cullBarrier = {};
+	cullBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+	cullBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+	cullBarrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+
+	vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+		VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, 0, 1, &cullBarrier, 0, nullptr,
+		0, nullptr);
+}
+
+void CullingPass::recordDraw(VkCommandBuffer commandBuffer, uint32_t frameIndex, uint32_t objectIndex)
+{
+	VkDeviceSize commandOffset = getCommandOffset(frameIndex, objectIndex);
+
+	if (drawIndexedIndirectCount != nullptr)
+	{
+		drawIndexedIndirectCount(commandBuffer, drawCommandBuffer, commandOffset, drawCommandBuffer,
+			commandOffset + offsetof(CulledDrawCommand, drawCount), 1, sizeof(VkDrawIndexedIndirectCommand));
+	}
+	else
+	{
+		vkCmdDrawIndexedIndirect(commandBuffer, drawCommandBuffer, commandOffset, 1,
+			sizeof(VkDrawIndexedIndirectCommand));
+	}
+}
+
+VkDeviceSize CullingPass::getCommandOffset(uint32_t frameIndex, uint32_t objectIndex) const
+{
+	return commandRegionSize * frameIndex + sizeof(CulledDrawCommand) * objectIndex;
+}
+
+VkDeviceSize CullingPass::alignUp(VkDeviceSize value) const
+{
+	return (value + storageAlignment - 1) / storageAlignment * storageAlignment;
+}
+
+void CullingPass::throwIfVisibleRegionTooLarge() const
+{
+	VkDeviceSize visibleSize = sizeof(InstanceData) * static_cast<VkDeviceSize>(visibleCapacity) * objectCount;
+
+	if (visibleSize > physicalDevice->getProperties().limits.maxStorageBufferRange)
+	{
+		throw std::runtime_error("Too many visible instances for the culling output buffer.");
+	}
+}
+
+void CullingPass::throwIfCreateDescriptorPoolFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create culling descriptor pool.");
+	}
+}
+
+void CullingPass::throwIfAllocateDescriptorSetsFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to allocate culling descriptor sets.");
+	}
+}
+
+VkBuffer CullingPass::getVisibleInstanceHandle() const
+{
+	return visibleInstanceBuffer;
+}
+
+VkDeviceSize CullingPass::getVisibleInstanceOffset(uint32_t frameIndex, uint32_t objectIndex) const
+{
+	return visibleRegionSize * frameIndex + sizeof(InstanceData) * visibleCapacity * objectIndex;
+}
+
+bool CullingPass::hasDrawIndirectCount() const
+{
+	return drawIndexedIndirectCount != nullptr;
+}
+
+bool CullingPass::hasVisibleCapacity(uint32_t instanceCount) const
+{
+	return instanceCount <= visibleCapacity;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <vulkan.h>
+#include <memory>
+#include <vector>
+#include "Buffer.h"
+#include "ObjectPushConstants.h"
+
+
+class CullingPipeline;
+class InstanceBuffer;
+class UniformBuffer;
+
+
+class CullingPass : public Buffer
+{
+private:
+	const uint32_t WORKGROUP_SIZE = 64;
+	const uint32_t MIN_VISIBLE_CAPACITY = 64;
+
+	std::shared_ptr<CullingPipeline> cullingPipeline;
+	std::shared_ptr<InstanceBuffer> instanceBuffer;
+	std::shared_ptr<UniformBuffer> uniformBuffer;
+	uint32_t frameCount;
+	uint32_t objectCount;
+	float meshRadius;
+	uint32_t visibleCapacity;
+	VkDeviceSize storageAlignment;
+	VkDeviceSize visibleRegionSize;
+	VkDeviceSize commandRegionSize;
+	VkDeviceSize dispatchRegionSize;
+
+	VkBuffer visibleInstanceBuffer;
+	MemoryAllocation visibleInstanceAllocation;
+	VkBuffer drawCommandBuffer;
+	MemoryAllocation drawCommandAllocation;
+	VkBuffer dispatchBuffer;
+	MemoryAllocation dispatchAllocation;
+	VkDescriptorPool vkDescriptorPool;
+	std::vector<VkDescriptorSet> descriptorSets;
+	PFN_vkCmdDrawIndexedIndirectCountKHR drawIndexedIndirectCount;
+
+	void createBuffers();
+	void createDescriptorPool();
+	void createDescriptorSets();
+	void writeDescriptorSet(uint32_t frameIndex);
+	void loadDrawIndirectCount();
+	VkDeviceSize getCommandOffset(uint32_t frameIndex, uint32_t objectIndex) const;
+	VkDeviceSize alignUp(VkDeviceSize value) const;
+	void throwIfVisibleRegionTooLarge() const;
+	void throwIfCreateDescriptorPoolFailed(VkResult result) const;
+	void throwIfAllocateDescriptorSetsFailed(VkResult result) const;
+
+public:
+	CullingPass(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
+		std::shared_ptr<MemoryAllocator> memoryAllocator, std::shared_ptr<CullingPipeline> cullingPipeline,
+		std::shared_ptr<InstanceBuffer> instanceBuffer, std::shared_ptr<UniformBuffer> uniformBuffer,
+		uint32_t frameCount, uint32_t objectCount, float meshRadius);
+
+	~CullingPass();
+
+	void writeDispatch(uint32_t frameIndex, uint32_t instanceCount);
+	void recordCulling(VkCommandBuffer commandBuffer, uint32_t frameIndex,
+		const std::vector<ObjectPushConstants>& objects);
+
+	void recordDraw(VkCommandBuffer commandBuffer, uint32_t frameIndex, uint32_t objectIndex);
+	VkBuffer getVisibleInstanceHandle() const;
+	VkDeviceSize getVisibleInstanceOffset(uint32_t frameIndex, uint32_t objectIndex) const;
+	bool hasDrawIndirectCount() const;
+	bool hasVisibleCapacity(uint32_t instanceCount) const;
+};
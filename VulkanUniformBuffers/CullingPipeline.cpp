@@ -0,0 +1,167 @@
+#include "CullingPipeline.h"
+#include "Device.h"
+#include "PipelineCache.h"
+#include "ShaderPack.h"
+#include "CullingPushConstants.h"
+#include <stdexcept>
+
+
+CullingPipeline::CullingPipeline(std::shared_ptr<Device> device, std::shared_ptr<PipelineCache> pipelineCache,
+	std::shared_ptr<ShaderPack> shaderPack)
+{
+	this->device = device;
+	this->pipelineCache = pipelineCache;
+	this->shaderPack = shaderPack;
+
+	createDescriptorSetLayout();
+	createPipelineLayout();
+	createPipeline();
+}
+
+CullingPipeline::~CullingPipeline()
+{
+	vkDestroyPipeline(device->getHandle(), vkPipeline, nullptr);
+	vkDestroyPipelineLayout(device->getHandle(), vkPipelineLayout, nullptr);
+	vkDestroyDescriptorSetLayout(device->getHandle(), vkDescriptorSetLayout, nullptr);
+}
+
+std::array<VkDescriptorSetLayoutBinding, 5> CullingPipeline::buildBindings() const
+{
+	std::array<VkDescriptorSetLayoutBinding, 5> bindings = {};
+
+	for (uint32_t i = 0; i < bindings.size(); ++i)
+	{
+		bindings[i].binding = i;
+		bindings[i].descriptorCount = 1;
+		bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+	}
+
+	bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+
+	return bindings;
+}
+
+VkPushConstantRange CullingPipeline::buildPushConstantRange() const
+{
+	VkPushConstantRange range = {};
+	range.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+	range.offset = 0;
+	range.size = sizeof(CullingPushConstants);
+
+	return range;
+}
+
+VkShaderModule CullingPipeline::loadShader(const char* name)
+{
+	ShaderCode shaderCode = shaderPack->getShaderCode(name);
+
+	VkShaderModuleCreateInfo createInfo = {};
+	createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+	createInfo.codeSize = shaderCode.size;
+	createInfo.pCode = shaderCode.code;
+
+	VkShaderModule shaderModule;
+	VkResult result = vkCreateShaderModule(device->getHandle(), &createInfo, nullptr, &shaderModule);
+	throwIfCreateShaderModuleFailed(result);
+
+	return shaderModule;
+}
+
+void CullingPipeline::createDescriptorSetLayout()
+{
+	std::array<VkDescriptorSetLayoutBinding, 5> bindings = buildBindings();
+
+	VkDescriptorSetLayoutCreateInfo createInfo = {};
+	createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+	createInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+	createInfo.pBindings = bindings.data();
+
+	VkResult result = vkCreateDescriptorSetLayout(device->getHandle(), &createInfo, nullptr,
+		&vkDescriptorSetLayout);
+	throwIfCreateDescriptorSetLayoutFailed(result);
+}
+
+void CullingPipeline::createPipelineLayout()
+{
+	VkPushConstantRange pushConstantRange = buildPushConstantRange();
+
+	VkPipelineLayoutCreateInfo createInfo = {};
+	createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+	createInfo.setLayoutCount = 1;
+	createInfo.pSetLayouts = &vkDescriptorSetLayout;
+	createInfo.pushConstantRangeCount = 1;
+	createInfo.pPushConstantRanges = &pushConstantRange;
+
+	VkResult result = vkCreatePipelineLayout(device->getHandle(), &createInfo, nullptr, &vkPipelineLayout);
+	throwIfCreatePipelineLayoutFailed(result);
+}
+
+void CullingPipeline::createPipeline()
+{
+	VkShaderModule computeShader = loadShader("cull.spv");
+
+	VkPipelineShaderStageCreateInfo stageCreateInfo = {};
+	stageCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	stageCreateInfo.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+	stageCreateInfo.module = computeShader;
+	stageCreateInfo.pName = "main";
+
+	VkComputePipelineCreateInfo createInfo = {};
+	createInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+	createInfo.stage = stageCreateInfo;
+	createInfo.layout = vkPipelineLayout;
+
+	VkResult result = vkCreateComputePipelines(device->getHandle(), pipelineCache->getHandle(), 1, &createInfo,
+		nullptr, &vkPipeline);
+
+	vkDestroyShaderModule(device->getHandle(), computeShader, nullptr);
+	throwIfCreatePipelineFailed(result);
+}
+
+void CullingPipeline::throwIfCreateDescriptorSetLayoutFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create culling descriptor set layout.");
+	}
+}
+
+void CullingPipeline::throwIfCreatePipelineLayoutFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create culling pipeline layout.");
+	}
+}
+
+void CullingPipeline::throwIfCreateShaderModuleFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create shader module.");
+	}
+}
+
+void CullingPipeline::throwIfCreatePipelineFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create culling pipeline.");
+	}
+}
+
+VkDescriptorSetLayout CullingPipeline::getDescriptorSetLayoutHandle() const
+{
+	return vkDescriptorSetLayout;
+}
+
+VkPipelineLayout CullingPipeline::getLayoutHandle() const
+{
+	return vkPipelineLayout;
+}
+
+VkPipeline CullingPipeline::getHandle() const
+{
+	return vkPipeline;
+}
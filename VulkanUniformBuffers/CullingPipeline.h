@@ -0,0 +1,43 @@
+#pragma once
+
+#include <vulkan.h>
+#include <memory>
+#include <array>
+
+
+class Device;
+class PipelineCache;
+class ShaderPack;
+
+
+class CullingPipeline
+{
+private:
+	std::shared_ptr<Device> device;
+	std::shared_ptr<PipelineCache> pipelineCache;
+	std::shared_ptr<ShaderPack> shaderPack;
+	VkDescriptorSetLayout vkDescriptorSetLayout;
+	VkPipelineLayout vkPipelineLayout;
+	VkPipeline vkPipeline;
+
+	std::array<VkDescriptorSetLayoutBinding, 5> buildBindings() const;
+	VkPushConstantRange buildPushConstantRange() const;
+	VkShaderModule loadShader(const char* name);
+	void createDescriptorSetLayout();
+	void createPipelineLayout();
+	void createPipeline();
+	void throwIfCreateDescriptorSetLayoutFailed(VkResult result) const;
+	void throwIfCreatePipelineLayoutFailed(VkResult result) const;
+	void throwIfCreateShaderModuleFailed(VkResult result) const;
+	void throwIfCreatePipelineFailed(VkResult result) const;
+
+public:
+	CullingPipeline(std::shared_ptr<Device> device, std::shared_ptr<PipelineCache> pipelineCache,
+		std::shared_ptr<ShaderPack> shaderPack);
+
+	~CullingPipeline();
+
+	VkDescriptorSetLayout getDescriptorSetLayoutHandle() const;
+	VkPipelineLayout getLayoutHandle() const;
+	VkPipeline getHandle() const;
+};
@@ -0,0 +1,16 @@
+#pragma once
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+
+#include "glm/mat4x4.hpp"
+#include <cstdint>
+
+
+struct CullingPushConstants
+{
+	glm::mat4 objectModel;
+	float meshRadius;
+	uint32_t objectIndex;
+	uint32_t visibleBase;
+};
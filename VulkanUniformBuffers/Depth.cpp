@@ -2,25 +2,22 @@
 #include "SwapChain.h"
 #include "Device.h"
 #include "PhysicalDevice.h"
+#include "MemoryAllocator.h"
 
 
 Depth::Depth(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
-	std::shared_ptr<SwapChain> swapChain)
+	std::shared_ptr<MemoryAllocator> memoryAllocator, std::shared_ptr<SwapChain> swapChain)
 {
 	this->physicalDevice = physicalDevice;
 	this->device = device;
+	this->memoryAllocator = memoryAllocator;
 
 	VkFormat format = findDepthFormat();
 	VkImageCreateInfo imageInfo = buildImageCreateInfo(swapChain, format);
 	VkResult result = createImage(&imageInfo);
 	throwIfCreateImageFailed(result);
 
-	VkMemoryAllocateInfo allocInfo = buildMemoryAllocateInfo();
-	result = allocateMemory(&allocInfo);
-	throwIfAllocateMemoryFailed(result);
-
-	result = bindImageMemory();
-	throwIfBindImageMemoryFailed(result);
+	allocateMemory();
 
 	VkImageViewCreateInfo imageViewCreateInfo = buildImageViewCreateInfo(format);
 	result = createImageView(&imageViewCreateInfo);
@@ -31,7 +28,7 @@ Depth::~Depth()
 {
 	vkDestroyImageView(device->getHandle(), vkImageView, nullptr);
 	vkDestroyImage(device->getHandle(), vkImage, nullptr);
-	vkFreeMemory(device->getHandle(), vkMemory, nullptr);
+	memoryAllocator->free(allocation);
 }
 
 VkImageCreateInfo Depth::buildImageCreateInfo(std::shared_ptr<SwapChain> swapChain, VkFormat format) const
@@ -67,44 +64,9 @@ void Depth::throwIfCreateImageFailed(VkResult result) const
 	}
 }
 
-VkMemoryAllocateInfo Depth::buildMemoryAllocateInfo() const
-{
-	VkMemoryRequirements memoryRequirements;
-	vkGetImageMemoryRequirements(device->getHandle(), vkImage, &memoryRequirements);
-
-	VkMemoryAllocateInfo allocInfo = {};
-	allocInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-	allocInfo.allocationSize = memoryRequirements.size;
-	allocInfo.memoryTypeIndex = physicalDevice->findMemoryType(memoryRequirements.memoryTypeBits,
-		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-
-	return allocInfo;
-}
-
-VkResult Depth::allocateMemory(VkMemoryAllocateInfo* allocInfo)
+void Depth::allocateMemory()
 {
-	return vkAllocateMemory(device->getHandle(), allocInfo, nullptr, &vkMemory);
-}
-
-void Depth::throwIfAllocateMemoryFailed(VkResult result) const
-{
-	if (result != VK_SUCCESS)
-	{
-		throw std::runtime_error("Failed to allocate depth device memory.");
-	}
-}
-
-VkResult Depth::bindImageMemory()
-{
-	return vkBindImageMemory(device->getHandle(), vkImage, vkMemory, 0);
-}
-
-void Depth::throwIfBindImageMemoryFailed(VkResult result) const
-{
-	if (result != VK_SUCCESS)
-	{
-		throw std::runtime_error("Failed to bind depth image memory.");
-	}
+	allocation = memoryAllocator->allocateImageMemory(vkImage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
 }
 
 VkImageViewCreateInfo Depth::buildImageViewCreateInfo(VkFormat format) const
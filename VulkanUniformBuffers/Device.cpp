@@ -6,17 +6,37 @@
 
 Device::Device(std::shared_ptr<PhysicalDevice> physicalDevice)
 {
-	std::vector<VkDeviceQueueCreateInfo> queueCreateInfos(2);
+	std::vector<VkDeviceQueueCreateInfo> queueCreateInfos(1);
 	QueueFamilyIndices queueFamilyIndices = physicalDevice->getQueueFamilyIndices();
 	buildGraphicsQueueCreateInfo(&queueFamilyIndices, &queueCreateInfos[0]);
-	buildPresentationQueueCreateInfo(&queueFamilyIndices, &queueCreateInfos[1]);
+
+	if (isPresentationFamilyDistinct(&queueFamilyIndices))
+	{
+		queueCreateInfos.emplace_back();
+		buildPresentationQueueCreateInfo(&queueFamilyIndices, &queueCreateInfos.back());
+	}
+
+	if (isTransferFamilyDistinct(&queueFamilyIndices))
+	{
+		queueCreateInfos.emplace_back();
+		buildTransferQueueCreateInfo(&queueFamilyIndices, &queueCreateInfos.back());
+	}
+
 	VkDeviceCreateInfo createInfo = buildDeviceCreateInfo(physicalDevice, &queueCreateInfos);
 
+	timelineSemaphoreEnabled = physicalDevice->isTimelineSemaphoreSupported();
+
+	if (timelineSemaphoreEnabled)
+	{
+		enableTimelineSemaphoreFeature(&createInfo);
+	}
+
 	VkResult result = createDevice(physicalDevice, &createInfo);
 	throwIfCreationFailed(result);
 
 	initGraphicsQueueHandle(&queueFamilyIndices);
 	initPresentationQueueHandle(&queueFamilyIndices);
+	initTransferQueueHandle(&queueFamilyIndices);
 }
 
 Device::~Device()
@@ -42,6 +62,27 @@ void Device::buildPresentationQueueCreateInfo(QueueFamilyIndices* queueFamilyInd
 	outQueueCreateInfo->pQueuePriorities = &queuePriority;
 }
 
+void Device::buildTransferQueueCreateInfo(QueueFamilyIndices* queueFamilyIndices, VkDeviceQueueCreateInfo* outQueueCreateInfo)
+{
+	*outQueueCreateInfo = {};
+	outQueueCreateInfo->sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+	outQueueCreateInfo->queueFamilyIndex = *queueFamilyIndices->transfer;
+	outQueueCreateInfo->queueCount = 1;
+	outQueueCreateInfo->pQueuePriorities = &queuePriority;
+}
+
+bool Device::isPresentationFamilyDistinct(QueueFamilyIndices* queueFamilyIndices) const
+{
+	return queueFamilyIndices->presentation != queueFamilyIndices->graphics;
+}
+
+bool Device::isTransferFamilyDistinct(QueueFamilyIndices* queueFamilyIndices) const
+{
+	return queueFamilyIndices->transfer.has_value() &&
+		queueFamilyIndices->transfer != queueFamilyIndices->graphics &&
+		queueFamilyIndices->transfer != queueFamilyIndices->presentation;
+}
+
 VkDeviceCreateInfo Device::buildDeviceCreateInfo(std::shared_ptr<PhysicalDevice> physicalDevice,
 	std::vector<VkDeviceQueueCreateInfo>* queueCreateInfos)
 {
@@ -56,6 +97,15 @@ VkDeviceCreateInfo Device::buildDeviceCreateInfo(std::shared_ptr<PhysicalDevice>
 	return createInfo;
 }
 
+void Device::enableTimelineSemaphoreFeature(VkDeviceCreateInfo* createInfo)
+{
+	timelineSemaphoreFeatures = {};
+	timelineSemaphoreFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+	timelineSemaphoreFeatures.timelineSemaphore = VK_TRUE;
+
+	createInfo->pNext = &timelineSemaphoreFeatures;
+}
+
 VkResult Device::createDevice(std::shared_ptr<PhysicalDevice> physicalDevice, VkDeviceCreateInfo* createInfo)
 {
 	return vkCreateDevice(physicalDevice->getHandle(), createInfo, nullptr, &vkDevice);
@@ -79,6 +129,16 @@ void Device::initPresentationQueueHandle(QueueFamilyIndices* queueFamilyIndices)
 	vkGetDeviceQueue(vkDevice, *queueFamilyIndices->presentation, 0, &vkPresentationQueue);
 }
 
+void Device::initTransferQueueHandle(QueueFamilyIndices* queueFamilyIndices)
+{
+	vkTransferQueue = VK_NULL_HANDLE;
+
+	if (queueFamilyIndices->transfer.has_value())
+	{
+		vkGetDeviceQueue(vkDevice, *queueFamilyIndices->transfer, 0, &vkTransferQueue);
+	}
+}
+
 VkDevice Device::getHandle() const
 {
 	return vkDevice;
@@ -92,4 +152,19 @@ VkQueue Device::getGraphicsQueueHandle() const
 VkQueue Device::getPresentationQueueHandle() const
 {
 	return vkPresentationQueue;
+}
+
+VkQueue Device::getTransferQueueHandle() const
+{
+	return vkTransferQueue;
+}
+
+bool Device::hasTransferQueue() const
+{
+	return vkTransferQueue != VK_NULL_HANDLE;
+}
+
+bool Device::hasTimelineSemaphores() const
+{
+	return timelineSemaphoreEnabled;
 }
\ No newline at end of file
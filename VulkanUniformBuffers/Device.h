@@ -13,20 +13,29 @@ private:
 	const float queuePriority = 1.0f;
 	const VkPhysicalDeviceFeatures deviceFeatures = {};
 
+	VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timelineSemaphoreFeatures;
+	bool timelineSemaphoreEnabled;
+
 	VkDevice vkDevice;
 	VkQueue vkGraphicsQueue;
 	VkQueue vkPresentationQueue;
+	VkQueue vkTransferQueue;
 
 	void buildGraphicsQueueCreateInfo(QueueFamilyIndices* queueFamilyIndices, VkDeviceQueueCreateInfo* outQueueCreateInfo);
 	void buildPresentationQueueCreateInfo(QueueFamilyIndices* queueFamilyIndices, VkDeviceQueueCreateInfo* outQueueCreateInfo);
+	void buildTransferQueueCreateInfo(QueueFamilyIndices* queueFamilyIndices, VkDeviceQueueCreateInfo* outQueueCreateInfo);
+	bool isPresentationFamilyDistinct(QueueFamilyIndices* queueFamilyIndices) const;
+	bool isTransferFamilyDistinct(QueueFamilyIndices* queueFamilyIndices) const;
 
 	VkDeviceCreateInfo buildDeviceCreateInfo(std::shared_ptr<PhysicalDevice> physicalDevice,
 		std::vector<VkDeviceQueueCreateInfo>* queueCreateInfos);
 
+	void enableTimelineSemaphoreFeature(VkDeviceCreateInfo* createInfo);
 	VkResult createDevice(std::shared_ptr<PhysicalDevice> physicalDevice, VkDeviceCreateInfo* createInfo);
 	void throwIfCreationFailed(VkResult result);
 	void initGraphicsQueueHandle(QueueFamilyIndices* queueFamilyIndices);
 	void initPresentationQueueHandle(QueueFamilyIndices* queueFamilyIndices);
+	void initTransferQueueHandle(QueueFamilyIndices* queueFamilyIndices);
 
 public:
 	Device(std::shared_ptr<PhysicalDevice> physicalDevice);
@@ -34,4 +43,7 @@ public:
 	VkDevice getHandle() const;
 	VkQueue getGraphicsQueueHandle() const;
 	VkQueue getPresentationQueueHandle() const;
+	VkQueue getTransferQueueHandle() const;
+	bool hasTransferQueue() const;
+	bool hasTimelineSemaphores() const;
 };
\ No newline at end of file
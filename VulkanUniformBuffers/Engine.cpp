@@ -4,6 +4,7 @@
 #include <vector>
 #include <set>
 #include <fstream>
+#include <algorithm>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include "VulkanInstance.h"
@@ -18,9 +19,29 @@
 #include "CommandPool.h"
 #include "Depth.h"
 #include "UniformBuffer.h"
+#include "Camera.h"
+#include "Simulation.h"
+#include "FrustumCuller.h"
+#include "UploadManager.h"
 #include "VertexBuffer.h"
 #include "IndexBuffer.h"
+#include "InstanceBuffer.h"
 #include "CommandBuffer.h"
+#include "MemoryAllocator.h"
+#include "PipelineCache.h"
+#include "ShaderPack.h"
+#include "TaskGraph.h"
+#include "TimelineSemaphore.h"
+#include "GpuProfiler.h"
+#include "CullingPipeline.h"
+#include "CullingPass.h"
+#include "UniformBenchmark.h"
+#include <thread>
+#include <iostream>
+
+#ifdef EMBED_SHADER_PACK
+#include "ShaderPackData.h"
+#endif
 
 
 void Engine::initVkInstance()
@@ -30,12 +51,22 @@ void Engine::initVkInstance()
 
 void Engine::createVkSurface()
 {
-	vulkanSurface = std::make_shared<VulkanSurface>(sdlWindow, vulkanInstance);
+	if (!headless)
+	{
+		vulkanSurface = std::make_shared<VulkanSurface>(sdlWindow, vulkanInstance);
+	}
 }
 
 void Engine::pickPhysicalDevice()
 {
-	physicalDevice = std::make_shared<PhysicalDevice>(vulkanInstance, vulkanSurface);
+	if (headless)
+	{
+		physicalDevice = std::make_shared<PhysicalDevice>(vulkanInstance);
+	}
+	else
+	{
+		physicalDevice = std::make_shared<PhysicalDevice>(vulkanInstance, vulkanSurface);
+	}
 }
 
 void Engine::createDevice()
@@ -43,9 +74,21 @@ void Engine::createDevice()
 	device = std::make_shared<Device>(physicalDevice);
 }
 
+void Engine::createMemoryAllocator()
+{
+	memoryAllocator = std::make_shared<MemoryAllocator>(physicalDevice, device);
+}
+
 void Engine::createSwapChain()
 {
-	swapChain = std::make_shared<SwapChain>(sdlWindow, physicalDevice, device, vulkanSurface);
+	if (headless)
+	{
+		swapChain = std::make_shared<SwapChain>(device, memoryAllocator, headlessExtent, HEADLESS_IMAGE_COUNT);
+	}
+	else
+	{
+		swapChain = std::make_shared<SwapChain>(sdlWindow, physicalDevice, device, vulkanSurface, presentPolicy);
+	}
 }
 
 void Engine::createRenderPass()
@@ -58,9 +101,57 @@ void Engine::createDescriptorSetLayout()
 	descriptorSetLayout = std::make_shared<DescriptorSetLayout>(device);
 }
 
+void Engine::createPipelineCache()
+{
+	pipelineCache = std::make_shared<PipelineCache>(physicalDevice, device, PIPELINE_CACHE_FILE_NAME);
+}
+
+// The cache only speeds up the next start, so a failed write must not stop the rest of the teardown.
+void Engine::savePipelineCache()
+{
+	try
+	{
+		pipelineCache->save();
+	}
+	catch (const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+	}
+}
+
+void Engine::createShaderPack()
+{
+#ifdef EMBED_SHADER_PACK
+	shaderPack = std::make_shared<ShaderPack>(SHADER_PACK_DATA, sizeof(SHADER_PACK_DATA));
+#else
+	shaderPack = std::make_shared<ShaderPack>(findShaderPackPath());
+#endif
+}
+
+std::string Engine::findShaderPackPath() const
+{
+	char* basePath = SDL_GetBasePath();
+
+	if (basePath == nullptr)
+	{
+		return SHADER_PACK_FILE_NAME;
+	}
+
+	std::string path = std::string(basePath) + SHADER_PACK_FILE_NAME;
+	SDL_free(basePath);
+
+	if (!std::ifstream(path).is_open())
+	{
+		return SHADER_PACK_FILE_NAME;
+	}
+
+	return path;
+}
+
 void Engine::createGraphicsPipeline()
 {
-	graphicsPipeline = std::make_shared<GraphicsPipeline>(device, swapChain, renderPass, descriptorSetLayout);
+	graphicsPipeline = std::make_shared<GraphicsPipeline>(device, renderPass, descriptorSetLayout, pipelineCache,
+		shaderPack, vertexTransformMode);
 }
 
 void Engine::createFramebuffers()
@@ -70,7 +161,8 @@ void Engine::createFramebuffers()
 
 void Engine::createUniformBuffers()
 {
-	uniformBuffer = std::make_shared<UniformBuffer>(physicalDevice, device, swapChain, descriptorSetLayout);
+	uniformBuffer = std::make_shared<UniformBuffer>(physicalDevice, device, memoryAllocator, swapChain,
+		descriptorSetLayout);
 }
 
 void Engine::createDescriptorPool()
@@ -85,34 +177,102 @@ void Engine::createDescriptorSets()
 
 void Engine::createVertexBuffer()
 {
-	vertexBuffer = std::make_shared<VertexBuffer>(physicalDevice, device, commandPool);
+	vertexBuffer = std::make_shared<VertexBuffer>(physicalDevice, device, memoryAllocator, uploadManager);
 }
 
 void Engine::createIndexBuffer()
 {
-	indexBuffer = std::make_shared<IndexBuffer>(physicalDevice, device, commandPool);
+	indexBuffer = std::make_shared<IndexBuffer>(physicalDevice, device, memoryAllocator, uploadManager);
+}
+
+void Engine::createInstanceBuffer()
+{
+	uint32_t frameCount = static_cast<uint32_t>(swapChain->getSwapChainImageViews()->size());
+	instanceBuffer = std::make_shared<InstanceBuffer>(physicalDevice, device, memoryAllocator, frameCount,
+		MAX_INSTANCE_COUNT, indexBuffer->getIndicesCount(), vertexBuffer->getBoundingRadius());
+
+	if (cullingMode == CullingMode::Cpu)
+	{
+		instanceBuffer->reserveVisible(static_cast<uint32_t>(m_sceneObjects.size()));
+	}
 }
 
 void Engine::createCommandPool()
 {
 	commandPool = std::make_shared<CommandPool>(physicalDevice, device);
+
+	if (device->hasTransferQueue())
+	{
+		uint32_t transferFamilyIndex = physicalDevice->getQueueFamilyIndices().transfer.value();
+		transferCommandPool = std::make_shared<CommandPool>(device, transferFamilyIndex);
+	}
+}
+
+void Engine::createUploadManager()
+{
+	uploadManager = std::make_shared<UploadManager>(physicalDevice, device, memoryAllocator, commandPool,
+		transferCommandPool, isTimelineSyncActive());
+}
+
+void Engine::submitUploads()
+{
+	uploadManager->submit();
+}
+
+void Engine::createGpuProfiler()
+{
+	uint32_t imageCount = static_cast<uint32_t>(swapChain->getSwapChainImageViews()->size());
+	gpuProfiler = std::make_shared<GpuProfiler>(physicalDevice, device, imageCount);
+}
+
+void Engine::createCullingPipeline()
+{
+	if (cullingMode == CullingMode::Gpu)
+	{
+		cullingPipeline = std::make_shared<CullingPipeline>(device, pipelineCache, shaderPack);
+	}
+}
+
+void Engine::createCullingPass()
+{
+	cullingPass.reset();
+
+	if (cullingMode == CullingMode::Gpu)
+	{
+		uint32_t frameCount = static_cast<uint32_t>(swapChain->getSwapChainImageViews()->size());
+		cullingPass = std::make_shared<CullingPass>(physicalDevice, device, memoryAllocator, cullingPipeline,
+			instanceBuffer, uniformBuffer, frameCount, static_cast<uint32_t>(m_sceneObjects.size()),
+			vertexBuffer->getBoundingRadius());
+	}
+}
+
+void Engine::createFrustumCuller()
+{
+	if (cullingMode == CullingMode::Cpu)
+	{
+		frustumCuller = std::make_shared<FrustumCuller>(
+			std::max(std::min(std::thread::hardware_concurrency(), MAX_CULLING_WORKER_COUNT), 1u));
+	}
 }
 
 void Engine::createCommandBuffers()
 {
 	commandBuffer = std::make_shared<CommandBuffer>(device, renderPass, framebuffer, commandPool, swapChain, 
-		graphicsPipeline, vertexBuffer, indexBuffer, uniformBuffer);
+		graphicsPipeline, vertexBuffer, indexBuffer, instanceBuffer, cullingPass, uniformBuffer, gpuProfiler,
+		m_sceneObjects, recordingWorkerCount, commandRecordingMode, static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT));
+
+	m_staleCommandImages.assign(framebuffer->getCount(), false);
 }
 
 void Engine::createSemaphores()
 {
-	m_vkImageAvailableSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
-	m_vkRenderFinishedSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
+	m_vkImageAvailableSemaphores.resize(framesInFlight);
+	m_vkRenderFinishedSemaphores.resize(framesInFlight);
 
 	VkSemaphoreCreateInfo semaphoreCreateInfo = {};
 	semaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
 
-	for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i)
+	for (size_t i = 0; i < framesInFlight; ++i)
 	{
 		VkResult result = vkCreateSemaphore(device->getHandle(), &semaphoreCreateInfo, nullptr, &m_vkImageAvailableSemaphores[i]);
 		if (result != VK_SUCCESS)
@@ -131,14 +291,20 @@ void Engine::createSemaphores()
 
 void Engine::createFences()
 {
-	m_vkFences.resize(MAX_FRAMES_IN_FLIGHT);
+	if (isTimelineSyncActive())
+	{
+		createFrameTimeline();
+		return;
+	}
+
+	m_vkFences.resize(framesInFlight);
 	m_vkImagesInFlightFences.resize(swapChain->getSwapChainImageViews()->size(), VK_NULL_HANDLE);
 
 	VkFenceCreateInfo fenceCreateInfo = {};
 	fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
 	fenceCreateInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
 
-	for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i)
+	for (size_t i = 0; i < framesInFlight; ++i)
 	{
 		VkResult result = vkCreateFence(device->getHandle(), &fenceCreateInfo, nullptr, &m_vkFences[i]);
 		if (result != VK_SUCCESS)
@@ -148,25 +314,207 @@ void Engine::createFences()
 	}
 }
 
+void Engine::createFrameTimeline()
+{
+	m_frameTimeline = std::make_shared<TimelineSemaphore>(device, 0);
+	m_frameTimelineValue = 0;
+	m_frameTimelineValues.assign(framesInFlight, 0);
+	m_imageTimelineValues.assign(swapChain->getSwapChainImageViews()->size(), 0);
+}
+
+void Engine::destroySyncObjects()
+{
+	for (size_t i = 0; i < m_vkImageAvailableSemaphores.size(); ++i)
+	{
+		vkDestroySemaphore(device->getHandle(), m_vkImageAvailableSemaphores[i], nullptr);
+		vkDestroySemaphore(device->getHandle(), m_vkRenderFinishedSemaphores[i], nullptr);
+	}
+
+	for (VkFence fence : m_vkFences)
+	{
+		vkDestroyFence(device->getHandle(), fence, nullptr);
+	}
+
+	m_vkImageAvailableSemaphores.clear();
+	m_vkRenderFinishedSemaphores.clear();
+	m_vkFences.clear();
+	m_vkImagesInFlightFences.clear();
+
+	m_frameTimeline.reset();
+	m_frameTimelineValues.clear();
+	m_imageTimelineValues.clear();
+}
+
+void Engine::rebuildSyncObjects()
+{
+	vkDeviceWaitIdle(device->getHandle());
+	destroySyncObjects();
+	createSemaphores();
+	createFences();
+	m_currentFrame = 0;
+}
+
+void Engine::recreateSwapChain()
+{
+	if (isWindowMinimized())
+	{
+		return;
+	}
+
+	vkDeviceWaitIdle(device->getHandle());
+
+	commandBuffer.reset();
+	framebuffer.reset();
+	depth.reset();
+
+	physicalDevice->updateSwapChainSupportDetails();
+	std::shared_ptr<SwapChain> oldSwapChain = swapChain;
+	swapChain = std::make_shared<SwapChain>(sdlWindow, physicalDevice, device, vulkanSurface, presentPolicy,
+		oldSwapChain->getHandle());
+
+	uniformBuffer->updateSwapChain(swapChain);
+	instanceBuffer->updateFrameCount(static_cast<uint32_t>(swapChain->getSwapChainImageViews()->size()));
+	createCullingPass();
+	camera->setAspectRatio(getAspectRatio());
+	bool formatChanged = swapChain->getSwapChainImageFormat() != oldSwapChain->getSwapChainImageFormat();
+	oldSwapChain.reset();
+
+	// The render pass bakes in the color attachment format, and the pipeline must match the render pass.
+	if (formatChanged)
+	{
+		graphicsPipeline.reset();
+		renderPass.reset();
+		createRenderPass();
+		createGraphicsPipeline();
+	}
+
+	createDepthResources();
+	createFramebuffers();
+	gpuProfiler->resize(static_cast<uint32_t>(swapChain->getSwapChainImageViews()->size()));
+	createCommandBuffers();
+
+	if (m_frameTimeline)
+	{
+		m_imageTimelineValues.assign(swapChain->getSwapChainImageViews()->size(), 0);
+	}
+	else
+	{
+		m_vkImagesInFlightFences.assign(swapChain->getSwapChainImageViews()->size(), VK_NULL_HANDLE);
+	}
+}
+
+bool Engine::isWindowMinimized() const
+{
+	int width, height;
+	SDL_Vulkan_GetDrawableSize(sdlWindow, &width, &height);
+
+	return width == 0 || height == 0;
+}
+
 void Engine::createDepthResources()
 {
-	depth = std::make_shared<Depth>(physicalDevice, device, swapChain);
+	depth = std::make_shared<Depth>(physicalDevice, device, memoryAllocator, swapChain);
 }
 
 void Engine::initScene()
 {
 	m_prevTime = std::chrono::high_resolution_clock::now();
-	uniformBuffer->initScene();
+
+	camera = std::make_shared<Camera>();
+	camera->setPosition(glm::vec3(0.0f, 0.0f, 2.0f));
+	camera->setAspectRatio(getAspectRatio());
+
+	std::shared_ptr<Camera> simulationCamera = std::make_shared<Camera>();
+	simulationCamera->setPosition(glm::vec3(0.0f, 0.0f, 2.0f));
+
+	simulation = std::make_shared<Simulation>(simulationCamera);
+	simulation->start();
+
+	addInstance(InstanceData{ glm::mat4(1.0f), glm::vec4(1.0f) });
+}
+
+float Engine::getAspectRatio() const
+{
+	VkExtent2D extent = swapChain->getSwapChainExtent();
+	return extent.width / static_cast<float>(extent.height);
 }
 
 void Engine::updateUniformBuffer(uint32_t imageIndex)
 {
-	uniformBuffer->updateUniformBuffer(imageIndex);
+	uniformBuffer->updateUniformBuffer(imageIndex, *camera);
+}
+
+// The CPU culler folds each scene object's transform into the frustum and writes that object's survivors into its
+// own visible slice.
+void Engine::writeInstances(uint32_t imageIndex)
+{
+	if (cullingMode != CullingMode::Cpu)
+	{
+		instanceBuffer->writeFrame(imageIndex);
+
+		if (cullingPass)
+		{
+			cullingPass->writeDispatch(imageIndex, instanceBuffer->getInstanceCount());
+		}
+
+		return;
+	}
+
+	glm::mat4 viewProjection = camera->getViewProjection();
+
+	for (uint32_t objectIndex = 0; objectIndex < m_sceneObjects.size(); ++objectIndex)
+	{
+		frustumCuller->cull(viewProjection * m_sceneObjects[objectIndex].model, instanceBuffer->getBounds());
+		instanceBuffer->writeVisibleObject(imageIndex, objectIndex, frustumCuller->getVisibleLists());
+	}
+}
+
+// Prerecorded buffers bake the object push constants in, so an image whose objects changed is re-recorded when it
+// comes up next. waitForImage has retired its previous submission by then, so the device never has to idle.
+void Engine::recordCommands(uint32_t imageIndex)
+{
+	if (commandRecordingMode == CommandRecordingMode::PerFrame)
+	{
+		commandBuffer->recordFrame(static_cast<uint32_t>(m_currentFrame), imageIndex, m_sceneObjects);
+	}
+	else if (m_staleCommandImages[imageIndex])
+	{
+		commandBuffer->recordFrame(imageIndex, imageIndex, m_sceneObjects);
+		m_staleCommandImages[imageIndex] = false;
+	}
+}
+
+// Culling output is sized from the live instance count, so outgrowing it reallocates the output and rebuilds the
+// command buffers that reference it once the device is idle.
+void Engine::growCullingOutput()
+{
+	bool cullingPassFull = cullingPass && !cullingPass->hasVisibleCapacity(instanceBuffer->getInstanceCount());
+	bool visibleSlicesFull = cullingMode == CullingMode::Cpu && !instanceBuffer->hasVisibleCapacity();
+
+	if (!cullingPassFull && !visibleSlicesFull)
+	{
+		return;
+	}
+
+	vkDeviceWaitIdle(device->getHandle());
+	commandBuffer.reset();
+
+	if (cullingPassFull)
+	{
+		createCullingPass();
+	}
+	else
+	{
+		instanceBuffer->reserveVisible(static_cast<uint32_t>(m_sceneObjects.size()));
+	}
+
+	createCommandBuffers();
 }
 
-void Engine::updateUniformBufferObject(float deltaSec)
+void Engine::updateCamera(std::chrono::high_resolution_clock::time_point currentTime)
 {
-	uniformBuffer->updateUniformBufferObject(m_inputState, deltaSec);
+	simulation->submitInput(m_inputState);
+	camera->setState(simulation->getInterpolatedCameraState(currentTime));
 
 	m_inputState.mouseXRel = 0;
 	m_inputState.mouseYRel = 0;
@@ -183,11 +531,6 @@ VkSurfaceFormatKHR Engine::chooseSwapSurfaceFormat(const std::vector<VkSurfaceFo
 	return formats[0];
 }
 
-VkPresentModeKHR Engine::chooseSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes)
-{
-	return VK_PRESENT_MODE_FIFO_KHR;
-}
-
 void Engine::readMouseButton(bool down, Uint8 button)
 {
 	switch (button)
@@ -224,38 +567,94 @@ void Engine::readKey(bool down, SDL_Keycode key)
 }
 
 Engine::Engine()
-	: MAX_FRAMES_IN_FLIGHT(2)
+	: framesInFlight(2),
+	presentPolicy(PresentPolicy::Vsync),
+	vertexTransformMode(VertexTransformMode::Premultiplied),
+	timelineSyncEnabled(true),
+	cullingMode(CullingMode::Gpu),
+	commandRecordingMode(CommandRecordingMode::Prerecorded),
+	headless(false),
+	initWorkerCount(std::max(std::min(std::thread::hardware_concurrency(), 4u), 1u)),
+	recordingWorkerCount(1),
+	initWallTimeMs(0.0),
+	initCriticalPathMs(0.0),
+	m_sceneObjects(1, ObjectPushConstants{ glm::mat4(1.0f) })
 {
 }
 
 void Engine::init(SDL_Window* sdlWindow)
 {
 	this->sdlWindow = sdlWindow;
+	headless = false;
+
+	runInitTaskGraph();
+}
+
+void Engine::initHeadless(uint32_t width, uint32_t height)
+{
+	sdlWindow = nullptr;
+	headless = true;
+	headlessExtent = { width, height };
+	m_headlessImageIndex = 0;
+
+	runInitTaskGraph();
+}
+
+void Engine::runInitTaskGraph()
+{
 	m_currentFrame = 0;
+	m_windowResized = false;
 
 	m_inputState = {};
 
-	initVkInstance();
-	createVkSurface();
-	pickPhysicalDevice();
-	createDevice();
-	createSwapChain();
-	createRenderPass();
-	createDescriptorSetLayout();
-	createGraphicsPipeline();
-	createCommandPool();
-	createVertexBuffer();
-	createIndexBuffer();
-	createUniformBuffers();
-	createDescriptorPool();
-	createDescriptorSets();
-	createDepthResources();
-	createFramebuffers();
-	createCommandBuffers();
-	createSemaphores();
-	createFences();
+	TaskGraph taskGraph;
+	buildInitTaskGraph(&taskGraph);
+	taskGraph.run(initWorkerCount);
+
+	initTimings = taskGraph.getTimings();
+	initWallTimeMs = taskGraph.getWallTimeMs();
+	initCriticalPathMs = taskGraph.getCriticalPathMs();
+}
 
-	initScene();
+void Engine::buildInitTaskGraph(TaskGraph* taskGraph)
+{
+	taskGraph->addTask("instance", [this] { initVkInstance(); });
+	taskGraph->addTask("surface", [this] { createVkSurface(); }, { "instance" });
+	taskGraph->addTask("physical device", [this] { pickPhysicalDevice(); }, { "surface" });
+	taskGraph->addTask("device", [this] { createDevice(); }, { "physical device" });
+	taskGraph->addTask("shader pack", [this] { createShaderPack(); });
+	taskGraph->addTask("memory allocator", [this] { createMemoryAllocator(); }, { "device" });
+	taskGraph->addTask("swap chain", [this] { createSwapChain(); },
+		{ headless ? "memory allocator" : "device" });
+	taskGraph->addTask("render pass", [this] { createRenderPass(); }, { "swap chain" });
+	taskGraph->addTask("descriptor set layout", [this] { createDescriptorSetLayout(); }, { "device" });
+	taskGraph->addTask("pipeline cache", [this] { createPipelineCache(); }, { "device" });
+	taskGraph->addTask("graphics pipeline", [this] { createGraphicsPipeline(); },
+		{ "render pass", "descriptor set layout", "pipeline cache", "shader pack" });
+	taskGraph->addTask("command pool", [this] { createCommandPool(); }, { "device" });
+	taskGraph->addTask("upload manager", [this] { createUploadManager(); }, { "memory allocator", "command pool" });
+	taskGraph->addTask("vertex buffer", [this] { createVertexBuffer(); }, { "upload manager" });
+	taskGraph->addTask("index buffer", [this] { createIndexBuffer(); }, { "upload manager" });
+	taskGraph->addTask("instance buffer", [this] { createInstanceBuffer(); }, { "swap chain", "vertex buffer", "index buffer" });
+	taskGraph->addTask("culling pipeline", [this] { createCullingPipeline(); },
+		{ "device", "pipeline cache", "shader pack" });
+	taskGraph->addTask("culling pass", [this] { createCullingPass(); },
+		{ "culling pipeline", "vertex buffer", "instance buffer", "uniform buffers" });
+	taskGraph->addTask("frustum culler", [this] { createFrustumCuller(); });
+	taskGraph->addTask("submit uploads", [this] { submitUploads(); }, { "vertex buffer", "index buffer" });
+	taskGraph->addTask("uniform buffers", [this] { createUniformBuffers(); },
+		{ "memory allocator", "swap chain", "descriptor set layout" });
+	taskGraph->addTask("descriptor pool", [this] { createDescriptorPool(); }, { "uniform buffers" });
+	taskGraph->addTask("descriptor sets", [this] { createDescriptorSets(); }, { "descriptor pool" });
+	taskGraph->addTask("depth resources", [this] { createDepthResources(); }, { "memory allocator", "swap chain" });
+	taskGraph->addTask("framebuffers", [this] { createFramebuffers(); }, { "render pass", "depth resources" });
+	taskGraph->addTask("gpu profiler", [this] { createGpuProfiler(); }, { "swap chain" });
+	taskGraph->addTask("command buffers", [this] { createCommandBuffers(); },
+		{ "framebuffers", "graphics pipeline", "submit uploads", "instance buffer", "culling pass", "descriptor sets",
+		"gpu profiler" });
+	taskGraph->addTask("semaphores", [this] { createSemaphores(); }, { "device" });
+	taskGraph->addTask("fences", [this] { createFences(); }, { "swap chain" });
+	taskGraph->addTask("scene", [this] { initScene(); }, { "swap chain", "instance buffer" });
 }
 
 void Engine::readInput(const SDL_Event& sdlEvent)
@@ -280,6 +679,11 @@ void Engine::readInput(const SDL_Event& sdlEvent)
 	}
 }
 
+void Engine::notifyWindowResized()
+{
+	m_windowResized = true;
+}
+
 void Engine::update()
 {
 	using namespace std::chrono;
@@ -288,95 +692,417 @@ void Engine::update()
 	float deltaSec = duration<float>(currentTime - m_prevTime).count();
 	m_prevTime = currentTime;
 
-	updateUniformBufferObject(deltaSec);
+	frameTimer.addSample(deltaSec * 1000.0);
+	updateCamera(currentTime);
 }
 
 void Engine::render()
 {
-	vkWaitForFences(device->getHandle(), 1, &m_vkFences[m_currentFrame], VK_TRUE, UINT64_MAX);
+	growCullingOutput();
+	waitForFrame();
 
 	uint32_t imageIndex;
+
+	if (!acquireNextImage(&imageIndex))
+	{
+		return;
+	}
+
+	waitForImage(imageIndex);
+	gpuProfiler->collectResults(imageIndex);
+	updateUniformBuffer(imageIndex);
+	writeInstances(imageIndex);
+	recordCommands(imageIndex);
+	submitFrame(imageIndex);
+	gpuProfiler->markSubmitted(imageIndex);
+	presentImage(imageIndex);
+
+	m_currentFrame = (m_currentFrame + 1) % framesInFlight;
+}
+
+bool Engine::acquireNextImage(uint32_t* outImageIndex)
+{
+	if (headless)
+	{
+		*outImageIndex = m_headlessImageIndex;
+		m_headlessImageIndex = (m_headlessImageIndex + 1) % HEADLESS_IMAGE_COUNT;
+		return true;
+	}
+
 	VkResult result = vkAcquireNextImageKHR(device->getHandle(), swapChain->getHandle(), UINT64_MAX,
-		m_vkImageAvailableSemaphores[m_currentFrame], VK_NULL_HANDLE, &imageIndex);
+		m_vkImageAvailableSemaphores[m_currentFrame], VK_NULL_HANDLE, outImageIndex);
 
-	if (result != VK_SUCCESS)
+	if (result == VK_ERROR_OUT_OF_DATE_KHR)
+	{
+		recreateSwapChain();
+		return false;
+	}
+
+	if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
 	{
 		throw std::runtime_error("Failed to acquire next image.");
 	}
 
+	return true;
+}
+
+void Engine::presentImage(uint32_t imageIndex)
+{
+	if (headless)
+	{
+		return;
+	}
+
+	VkSemaphore renderFinishedSemaphores[] = { m_vkRenderFinishedSemaphores[m_currentFrame] };
+	VkSwapchainKHR swapChains[] = { swapChain->getHandle() };
+
+	VkPresentInfoKHR presentInfo = {};
+	presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+	presentInfo.waitSemaphoreCount = 1;
+	presentInfo.pWaitSemaphores = renderFinishedSemaphores;
+	presentInfo.swapchainCount = 1;
+	presentInfo.pSwapchains = swapChains;
+	presentInfo.pImageIndices = &imageIndex;
+
+	VkResult result = vkQueuePresentKHR(device->getPresentationQueueHandle(), &presentInfo);
+	if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || m_windowResized)
+	{
+		m_windowResized = false;
+		recreateSwapChain();
+	}
+	else if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to queue presentation.");
+	}
+}
+
+void Engine::waitForFrame()
+{
+	if (m_frameTimeline)
+	{
+		m_frameTimeline->wait(m_frameTimelineValues[m_currentFrame]);
+		return;
+	}
+
+	vkWaitForFences(device->getHandle(), 1, &m_vkFences[m_currentFrame], VK_TRUE, UINT64_MAX);
+}
+
+void Engine::waitForImage(uint32_t imageIndex)
+{
+	if (m_frameTimeline)
+	{
+		m_frameTimeline->wait(m_imageTimelineValues[imageIndex]);
+		return;
+	}
+
 	if (m_vkImagesInFlightFences[imageIndex] != VK_NULL_HANDLE)
 	{
 		vkWaitForFences(device->getHandle(), 1, &m_vkImagesInFlightFences[imageIndex], VK_TRUE, UINT64_MAX);
 	}
 
+	m_vkImagesInFlightFences[imageIndex] = m_vkFences[m_currentFrame];
+}
+
+void Engine::submitFrame(uint32_t imageIndex)
+{
 	VkSemaphore waitSemaphores[] = { m_vkImageAvailableSemaphores[m_currentFrame] };
-	VkSemaphore signalSemaphores[] = { m_vkRenderFinishedSemaphores[m_currentFrame] };
 	VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
-
-	updateUniformBuffer(imageIndex);
+	std::vector<VkSemaphore> signalSemaphores;
 
 	VkSubmitInfo submitInfo = {};
 	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-	submitInfo.waitSemaphoreCount = 1;
-	submitInfo.pWaitSemaphores = waitSemaphores;
-	submitInfo.pWaitDstStageMask = waitStages;
 	submitInfo.commandBufferCount = 1;
-	submitInfo.pCommandBuffers = commandBuffer->getHandlePtr(imageIndex);
-	submitInfo.signalSemaphoreCount = 1;
-	submitInfo.pSignalSemaphores = signalSemaphores;
+	submitInfo.pCommandBuffers = commandBuffer->getHandlePtr(static_cast<uint32_t>(m_currentFrame), imageIndex);
+
+	if (!headless)
+	{
+		submitInfo.waitSemaphoreCount = 1;
+		submitInfo.pWaitSemaphores = waitSemaphores;
+		submitInfo.pWaitDstStageMask = waitStages;
+		signalSemaphores.push_back(m_vkRenderFinishedSemaphores[m_currentFrame]);
+	}
+
+	if (m_frameTimeline)
+	{
+		submitFrameWithTimeline(&submitInfo, &signalSemaphores, imageIndex);
+	}
+	else
+	{
+		submitFrameWithFence(&submitInfo, &signalSemaphores);
+	}
+}
+
+void Engine::submitFrameWithFence(VkSubmitInfo* submitInfo, std::vector<VkSemaphore>* signalSemaphores)
+{
+	submitInfo->signalSemaphoreCount = static_cast<uint32_t>(signalSemaphores->size());
+	submitInfo->pSignalSemaphores = signalSemaphores->data();
 
 	vkResetFences(device->getHandle(), 1, &m_vkFences[m_currentFrame]);
 
-	result = vkQueueSubmit(device->getGraphicsQueueHandle(), 1, &submitInfo, m_vkFences[m_currentFrame]);
+	VkResult result = vkQueueSubmit(device->getGraphicsQueueHandle(), 1, submitInfo, m_vkFences[m_currentFrame]);
 	if (result != VK_SUCCESS)
 	{
 		throw std::runtime_error("Failed to queue submit.");
 	}
+}
 
-	VkSwapchainKHR swapChains[] = { swapChain->getHandle() };
+void Engine::submitFrameWithTimeline(VkSubmitInfo* submitInfo, std::vector<VkSemaphore>* signalSemaphores,
+	uint32_t imageIndex)
+{
+	uint64_t signalValue = m_frameTimelineValue + 1;
+	signalSemaphores->push_back(m_frameTimeline->getHandle());
+
+	// Binary semaphores ignore their values; only the timeline entry is meaningful.
+	std::vector<uint64_t> waitValues(submitInfo->waitSemaphoreCount, 0);
+	std::vector<uint64_t> signalValues(signalSemaphores->size(), 0);
+	signalValues.back() = signalValue;
+
+	VkTimelineSemaphoreSubmitInfoKHR timelineSubmitInfo = {};
+	timelineSubmitInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+	timelineSubmitInfo.waitSemaphoreValueCount = static_cast<uint32_t>(waitValues.size());
+	timelineSubmitInfo.pWaitSemaphoreValues = waitValues.data();
+	timelineSubmitInfo.signalSemaphoreValueCount = static_cast<uint32_t>(signalValues.size());
+	timelineSubmitInfo.pSignalSemaphoreValues = signalValues.data();
+
+	submitInfo->pNext = &timelineSubmitInfo;
+	submitInfo->signalSemaphoreCount = static_cast<uint32_t>(signalSemaphores->size());
+	submitInfo->pSignalSemaphores = signalSemaphores->data();
+
+	VkResult result = vkQueueSubmit(device->getGraphicsQueueHandle(), 1, submitInfo, VK_NULL_HANDLE);
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to queue submit.");
+	}
 
-	VkPresentInfoKHR presentInfo = {};
-	presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
-	presentInfo.waitSemaphoreCount = 1;
-	presentInfo.pWaitSemaphores = signalSemaphores;
-	presentInfo.swapchainCount = 1;
-	presentInfo.pSwapchains = swapChains;
-	presentInfo.pImageIndices = &imageIndex;
+	m_frameTimelineValue = signalValue;
+	m_frameTimelineValues[m_currentFrame] = signalValue;
+	m_imageTimelineValues[imageIndex] = signalValue;
+}
 
-	result = vkQueuePresentKHR(device->getPresentationQueueHandle(), &presentInfo);
-	if (result != VK_SUCCESS)
+void Engine::setFramesInFlight(int framesInFlight)
+{
+	framesInFlight = std::clamp(framesInFlight, 1, MAX_FRAMES_IN_FLIGHT);
+
+	if (framesInFlight == this->framesInFlight)
 	{
-		throw std::runtime_error("Failed to queue presentation.");
+		return;
+	}
+
+	this->framesInFlight = framesInFlight;
+
+	if (device)
+	{
+		rebuildSyncObjects();
+	}
+}
+
+int Engine::getFramesInFlight() const
+{
+	return framesInFlight;
+}
+
+void Engine::setInitWorkerCount(uint32_t initWorkerCount)
+{
+	this->initWorkerCount = std::max(initWorkerCount, 1u);
+}
+
+void Engine::setRecordingWorkerCount(uint32_t recordingWorkerCount)
+{
+	this->recordingWorkerCount = std::max(recordingWorkerCount, 1u);
+}
+
+void Engine::setSceneObjectCount(uint32_t sceneObjectCount)
+{
+	if (device)
+	{
+		throw std::runtime_error("Scene object count must be set before init.");
+	}
+
+	m_sceneObjects.assign(std::min(std::max(sceneObjectCount, 1u), MAX_SCENE_OBJECT_COUNT),
+		ObjectPushConstants{ glm::mat4(1.0f) });
+}
+
+uint32_t Engine::getActiveRecordingWorkerCount() const
+{
+	return commandBuffer->getActiveWorkerCount();
+}
+
+const std::vector<TaskTiming>& Engine::getInitTimings() const
+{
+	return initTimings;
+}
+
+double Engine::getInitWallTimeMs() const
+{
+	return initWallTimeMs;
+}
+
+double Engine::getInitCriticalPathMs() const
+{
+	return initCriticalPathMs;
+}
+
+void Engine::setPresentPolicy(PresentPolicy presentPolicy)
+{
+	this->presentPolicy = presentPolicy;
+}
+
+void Engine::setVertexTransformMode(VertexTransformMode vertexTransformMode)
+{
+	this->vertexTransformMode = vertexTransformMode;
+}
+
+void Engine::setCullingMode(CullingMode cullingMode)
+{
+	this->cullingMode = cullingMode;
+}
+
+void Engine::setCommandRecordingMode(CommandRecordingMode commandRecordingMode)
+{
+	this->commandRecordingMode = commandRecordingMode;
+}
+
+void Engine::setTimelineSyncEnabled(bool timelineSyncEnabled)
+{
+	if (timelineSyncEnabled == this->timelineSyncEnabled)
+	{
+		return;
+	}
+
+	this->timelineSyncEnabled = timelineSyncEnabled;
+
+	if (device)
+	{
+		rebuildSyncObjects();
+	}
+}
+
+bool Engine::isTimelineSyncActive() const
+{
+	return timelineSyncEnabled && device && device->hasTimelineSemaphores();
+}
+
+FrameStats Engine::getFrameStats() const
+{
+	return frameTimer.getStats();
+}
+
+FrameStats Engine::getRecordingStats() const
+{
+	return commandBuffer->getRecordingStats();
+}
+
+bool Engine::isPerFrameRecordingActive() const
+{
+	return commandRecordingMode == CommandRecordingMode::PerFrame;
+}
+
+void Engine::resetFrameStats()
+{
+	frameTimer.reset();
+	gpuProfiler->resetStats();
+	commandBuffer->resetRecordingStats();
+}
+
+std::vector<GpuRegionStats> Engine::getGpuStats() const
+{
+	return gpuProfiler->getStats();
+}
+
+std::vector<UniformBenchmarkResult> Engine::runUniformBenchmark(const std::vector<uint32_t>& objectCounts,
+	uint32_t frameCount)
+{
+	vkDeviceWaitIdle(device->getHandle());
+
+	UniformBenchmark uniformBenchmark(physicalDevice, device, memoryAllocator, pipelineCache, shaderPack);
+	return uniformBenchmark.runAll(objectCounts, frameCount);
+}
+
+bool Engine::isPipelineCacheWarm() const
+{
+	return pipelineCache->isLoadedFromDisk();
+}
+
+double Engine::getPipelineCreationTimeMs() const
+{
+	return graphicsPipeline->getCreationTimeMs();
+}
+
+MemoryAllocatorStats Engine::getMemoryStats() const
+{
+	return memoryAllocator->getStats();
+}
+
+uint32_t Engine::addInstance(const InstanceData& instanceData)
+{
+	return instanceBuffer->addInstance(instanceData);
+}
+
+void Engine::removeInstance(uint32_t id)
+{
+	instanceBuffer->removeInstance(id);
+}
+
+void Engine::updateInstance(uint32_t id, const InstanceData& instanceData)
+{
+	instanceBuffer->updateInstance(id, instanceData);
+}
+
+uint32_t Engine::getInstanceCount() const
+{
+	return instanceBuffer->getInstanceCount();
+}
+
+uint32_t Engine::getMaxInstanceCount() const
+{
+	return MAX_INSTANCE_COUNT;
+}
+
+// With prerecorded command buffers each call costs one re-recording of every swapchain image. That suits one-off
+// placement, but transforms that change every frame should use per-frame recording.
+void Engine::setSceneObjectModel(uint32_t index, const glm::mat4& model)
+{
+	if (index >= m_sceneObjects.size())
+	{
+		throw std::runtime_error("Invalid scene object index.");
 	}
 
-	vkQueueWaitIdle(device->getPresentationQueueHandle());
+	m_sceneObjects[index].model = model;
+	m_staleCommandImages.assign(m_staleCommandImages.size(), true);
+}
 
-	m_currentFrame = (m_currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+uint32_t Engine::getSceneObjectCount() const
+{
+	return static_cast<uint32_t>(m_sceneObjects.size());
 }
 
 void Engine::cleanUp()
 {
+	simulation.reset();
 	vkDeviceWaitIdle(device->getHandle());
 
+	commandBuffer.reset();
+	gpuProfiler.reset();
+	cullingPass.reset();
+	frustumCuller.reset();
 	vertexBuffer.reset();
 	indexBuffer.reset();
+	instanceBuffer.reset();
 	uniformBuffer.reset();
+	camera.reset();
+	uploadManager.reset();
 
-	for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i)
-	{
-		vkDestroySemaphore(device->getHandle(), m_vkImageAvailableSemaphores[i], nullptr);
-		vkDestroySemaphore(device->getHandle(), m_vkRenderFinishedSemaphores[i], nullptr);
-		vkDestroyFence(device->getHandle(), m_vkFences[i], nullptr);
-	}
+	destroySyncObjects();
 
-	for (VkFence imagesInFlightFence : m_vkImagesInFlightFences)
-	{
-		vkDestroyFence(device->getHandle(), imagesInFlightFence, nullptr);
-	}
-	
 	depth.reset();
+	memoryAllocator.reset();
+	transferCommandPool.reset();
 	commandPool.reset();
 	graphicsPipeline.reset();
+	cullingPipeline.reset();
+	savePipelineCache();
+	pipelineCache.reset();
+	shaderPack.reset();
 	swapChain.reset();
 	framebuffer.reset();
 	descriptorSetLayout.reset();
@@ -17,6 +17,17 @@
 #include "QueueFamilyIndices.h"
 #include "Vertex.h"
 #include "InputState.h"
+#include "MemoryAllocatorStats.h"
+#include "FrameTimer.h"
+#include "PresentPolicy.h"
+#include "VertexTransformMode.h"
+#include "CullingMode.h"
+#include "CommandRecordingMode.h"
+#include "TaskTiming.h"
+#include "GpuRegionStats.h"
+#include "UniformBenchmarkResult.h"
+#include "ObjectPushConstants.h"
+#include "InstanceData.h"
 
 
 class VulkanInstance;
@@ -29,51 +40,112 @@ class DescriptorSetLayout;
 class GraphicsPipeline;
 class Framebuffer;
 class CommandPool;
+class UploadManager;
 class Depth;
 class UniformBuffer;
+class Camera;
+class Simulation;
 class VertexBuffer;
 class IndexBuffer;
+class InstanceBuffer;
 class CommandBuffer;
+class MemoryAllocator;
+class PipelineCache;
+class ShaderPack;
+class TaskGraph;
+class TimelineSemaphore;
+class GpuProfiler;
+class CullingPipeline;
+class CullingPass;
+class FrustumCuller;
 
 
 class Engine
 {
 private:
-	const int MAX_FRAMES_IN_FLIGHT;
+	const int MAX_FRAMES_IN_FLIGHT = 3;
+	const char* PIPELINE_CACHE_FILE_NAME = "pipeline_cache.bin";
+	const char* SHADER_PACK_FILE_NAME = "shaders.pack";
+	const uint32_t HEADLESS_IMAGE_COUNT = 3;
+	const uint32_t MAX_INSTANCE_COUNT = 100000;
+	const uint32_t MAX_CULLING_WORKER_COUNT = 4;
+	const uint32_t MAX_SCENE_OBJECT_COUNT = 4096;
+
+	int framesInFlight;
+	PresentPolicy presentPolicy;
+	VertexTransformMode vertexTransformMode;
+	bool timelineSyncEnabled;
+	CullingMode cullingMode;
+	CommandRecordingMode commandRecordingMode;
+	bool headless;
+	VkExtent2D headlessExtent;
+	uint32_t initWorkerCount;
+	uint32_t recordingWorkerCount;
+	std::vector<TaskTiming> initTimings;
+	double initWallTimeMs;
+	double initCriticalPathMs;
 
 	struct SDL_Window* sdlWindow;
 	std::shared_ptr<VulkanInstance> vulkanInstance;
 	std::shared_ptr<VulkanSurface> vulkanSurface;
 	std::shared_ptr<PhysicalDevice> physicalDevice;
 	std::shared_ptr<Device> device;
+	std::shared_ptr<MemoryAllocator> memoryAllocator;
 	std::shared_ptr<SwapChain> swapChain;
 	std::shared_ptr<RenderPass> renderPass;
 	std::shared_ptr<DescriptorSetLayout> descriptorSetLayout;
+	std::shared_ptr<PipelineCache> pipelineCache;
+	std::shared_ptr<ShaderPack> shaderPack;
 	std::shared_ptr<GraphicsPipeline> graphicsPipeline;
 	std::shared_ptr<Framebuffer> framebuffer;
 	std::shared_ptr<CommandPool> commandPool;
+	std::shared_ptr<CommandPool> transferCommandPool;
+	std::shared_ptr<UploadManager> uploadManager;
 	std::shared_ptr<Depth> depth;
 	std::shared_ptr<UniformBuffer> uniformBuffer;
+	std::shared_ptr<Camera> camera;
+	std::shared_ptr<Simulation> simulation;
 	std::shared_ptr<VertexBuffer> vertexBuffer;
 	std::shared_ptr<IndexBuffer> indexBuffer;
+	std::shared_ptr<InstanceBuffer> instanceBuffer;
 	std::shared_ptr<CommandBuffer> commandBuffer;
+	std::shared_ptr<GpuProfiler> gpuProfiler;
+	std::shared_ptr<CullingPipeline> cullingPipeline;
+	std::shared_ptr<CullingPass> cullingPass;
+	std::shared_ptr<FrustumCuller> frustumCuller;
 
 	std::vector<VkSemaphore> m_vkImageAvailableSemaphores;
 	std::vector<VkSemaphore> m_vkRenderFinishedSemaphores;
 	std::vector<VkFence> m_vkFences;
 	std::vector<VkFence> m_vkImagesInFlightFences;
+	std::shared_ptr<TimelineSemaphore> m_frameTimeline;
+	uint64_t m_frameTimelineValue;
+	std::vector<uint64_t> m_frameTimelineValues;
+	std::vector<uint64_t> m_imageTimelineValues;
 	int m_currentFrame;
+	uint32_t m_headlessImageIndex;
+	bool m_windowResized;
 
 	std::chrono::high_resolution_clock::time_point m_prevTime;
+	FrameTimer frameTimer;
 	InputState m_inputState;
+	std::vector<ObjectPushConstants> m_sceneObjects;
+	std::vector<bool> m_staleCommandImages;
 
+	void runInitTaskGraph();
+	void buildInitTaskGraph(TaskGraph* taskGraph);
 	void initVkInstance();
 	void createVkSurface();
 	void pickPhysicalDevice();
 	void createDevice();
+	void createMemoryAllocator();
 	void createSwapChain();
 	void createRenderPass();
 	void createDescriptorSetLayout();
+	void createPipelineCache();
+	void savePipelineCache();
+	void createShaderPack();
+	std::string findShaderPackPath() const;
 	void createGraphicsPipeline();
 	void createFramebuffers();
 	void createUniformBuffers();
@@ -82,18 +154,43 @@ private:
 
 	void createVertexBuffer();
 	void createIndexBuffer();
+	void createInstanceBuffer();
 	void createCommandPool();
+	void createUploadManager();
+	void submitUploads();
+	void createGpuProfiler();
+	void createCullingPipeline();
+	void createCullingPass();
+	void createFrustumCuller();
 	void createCommandBuffers();
 	void createSemaphores();
 	void createFences();
+	void createFrameTimeline();
+	void destroySyncObjects();
+	void rebuildSyncObjects();
+	void waitForFrame();
+	void waitForImage(uint32_t imageIndex);
+	bool acquireNextImage(uint32_t* outImageIndex);
+	void submitFrame(uint32_t imageIndex);
+	void submitFrameWithFence(VkSubmitInfo* submitInfo, std::vector<VkSemaphore>* signalSemaphores);
+
+	void submitFrameWithTimeline(VkSubmitInfo* submitInfo, std::vector<VkSemaphore>* signalSemaphores,
+		uint32_t imageIndex);
+
+	void presentImage(uint32_t imageIndex);
+	void recreateSwapChain();
+	bool isWindowMinimized() const;
 	void createDepthResources();
 
 	void initScene();
+	float getAspectRatio() const;
 	void updateUniformBuffer(uint32_t imageIndex);
-	void updateUniformBufferObject(float deltaSec);
+	void writeInstances(uint32_t imageIndex);
+	void recordCommands(uint32_t imageIndex);
+	void growCullingOutput();
+	void updateCamera(std::chrono::high_resolution_clock::time_point currentTime);
 
 	VkSurfaceFormatKHR chooseSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& formats);
-	VkPresentModeKHR chooseSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes);
 	bool hasStencilComponent(VkFormat format);
 
 	void readMouseButton(bool down, Uint8 button);
@@ -104,9 +201,44 @@ public:
 	Engine();
 
 	void init(SDL_Window* sdlWindow);
+	void initHeadless(uint32_t width, uint32_t height);
 	void readInput(const SDL_Event& sdlEvent);
+	void notifyWindowResized();
 	void update();
 	void render();
 	void cleanUp();
+
+	void setFramesInFlight(int framesInFlight);
+	int getFramesInFlight() const;
+	void setPresentPolicy(PresentPolicy presentPolicy);
+	void setVertexTransformMode(VertexTransformMode vertexTransformMode);
+	void setTimelineSyncEnabled(bool timelineSyncEnabled);
+	void setCullingMode(CullingMode cullingMode);
+	void setCommandRecordingMode(CommandRecordingMode commandRecordingMode);
+	bool isTimelineSyncActive() const;
+	void setInitWorkerCount(uint32_t initWorkerCount);
+	void setRecordingWorkerCount(uint32_t recordingWorkerCount);
+	void setSceneObjectCount(uint32_t sceneObjectCount);
+	uint32_t getActiveRecordingWorkerCount() const;
+	const std::vector<TaskTiming>& getInitTimings() const;
+	double getInitWallTimeMs() const;
+	double getInitCriticalPathMs() const;
+	FrameStats getFrameStats() const;
+	FrameStats getRecordingStats() const;
+	bool isPerFrameRecordingActive() const;
+	bool isPipelineCacheWarm() const;
+	double getPipelineCreationTimeMs() const;
+	void resetFrameStats();
+	std::vector<GpuRegionStats> getGpuStats() const;
+	std::vector<UniformBenchmarkResult> runUniformBenchmark(const std::vector<uint32_t>& objectCounts,
+		uint32_t frameCount);
+	MemoryAllocatorStats getMemoryStats() const;
+	uint32_t addInstance(const InstanceData& instanceData);
+	void removeInstance(uint32_t id);
+	void updateInstance(uint32_t id, const InstanceData& instanceData);
+	uint32_t getInstanceCount() const;
+	uint32_t getMaxInstanceCount() const;
+	void setSceneObjectModel(uint32_t index, const glm::mat4& model);
+	uint32_t getSceneObjectCount() const;
 };
 
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+struct FrameStats
+{
+	uint32_t frameCount;
+	double averageMs;
+	double minMs;
+	double maxMs;
+	double p50Ms;
+	double p95Ms;
+	double p99Ms;
+};
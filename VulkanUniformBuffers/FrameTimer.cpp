@@ -0,0 +1,59 @@
+#include "FrameTimer.h"
+#include <algorithm>
+#include <numeric>
+
+
+FrameTimer::FrameTimer()
+{
+	nextSample = 0;
+	samples.reserve(MAX_SAMPLES);
+}
+
+void FrameTimer::addSample(double frameTimeMs)
+{
+	if (samples.size() < MAX_SAMPLES)
+	{
+		samples.push_back(frameTimeMs);
+	}
+	else
+	{
+		samples[nextSample] = frameTimeMs;
+	}
+
+	nextSample = (nextSample + 1) % MAX_SAMPLES;
+}
+
+void FrameTimer::reset()
+{
+	samples.clear();
+	nextSample = 0;
+}
+
+FrameStats FrameTimer::getStats() const
+{
+	FrameStats stats = {};
+
+	if (samples.empty())
+	{
+		return stats;
+	}
+
+	std::vector<double> sortedSamples(samples);
+	std::sort(sortedSamples.begin(), sortedSamples.end());
+
+	stats.frameCount = static_cast<uint32_t>(sortedSamples.size());
+	stats.averageMs = std::accumulate(sortedSamples.begin(), sortedSamples.end(), 0.0) / sortedSamples.size();
+	stats.minMs = sortedSamples.front();
+	stats.maxMs = sortedSamples.back();
+	stats.p50Ms = percentile(sortedSamples, 0.50);
+	stats.p95Ms = percentile(sortedSamples, 0.95);
+	stats.p99Ms = percentile(sortedSamples, 0.99);
+
+	return stats;
+}
+
+double FrameTimer::percentile(const std::vector<double>& sortedSamples, double fraction) const
+{
+	size_t index = static_cast<size_t>(fraction * (sortedSamples.size() - 1) + 0.5);
+	return sortedSamples[index];
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "FrameStats.h"
+
+
+class FrameTimer
+{
+private:
+	const size_t MAX_SAMPLES = 4096;
+
+	std::vector<double> samples;
+	size_t nextSample;
+
+	double percentile(const std::vector<double>& sortedSamples, double fraction) const;
+
+public:
+	FrameTimer();
+
+	void addSample(double frameTimeMs);
+	void reset();
+	FrameStats getStats() const;
+};
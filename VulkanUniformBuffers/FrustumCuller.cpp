@@ -0,0 +1,141 @@
+#include "FrustumCuller.h"
+#include <algorithm>
+#include <cmath>
+#include "glm/vec4.hpp"
+#include "CullingKernels.h"
+
+
+FrustumCuller::FrustumCuller(uint32_t workerCount)
+	: kernel(detectCullingKernel()),
+	workerPool(workerCount),
+	planes(),
+	bounds(nullptr),
+	objectCount(0),
+	activeWorkerCount(0),
+	chunkSize(0)
+{
+	visibleLists.resize(workerPool.getWorkerCount());
+}
+
+// Small scenes run on the calling thread alone.
+void FrustumCuller::cull(const glm::mat4& viewProjection, const InstanceBounds& bounds)
+{
+	this->planes = extractPlanes(viewProjection);
+	this->bounds = &bounds;
+	objectCount = static_cast<uint32_t>(bounds.radius.size());
+
+	uint32_t workerCount = workerPool.getWorkerCount();
+	uint32_t neededWorkers = (objectCount + MIN_OBJECTS_PER_WORKER - 1) / MIN_OBJECTS_PER_WORKER;
+	activeWorkerCount = std::min(std::max(neededWorkers, 1u), workerCount);
+	chunkSize = ((objectCount + activeWorkerCount - 1) / activeWorkerCount + 7) / 8 * 8;
+
+	for (uint32_t i = activeWorkerCount; i < workerCount; ++i)
+	{
+		visibleLists[i].clear();
+	}
+
+	workerPool.run(activeWorkerCount, [this](uint32_t workerIndex) { cullChunk(workerIndex); });
+}
+
+void FrustumCuller::cullChunk(uint32_t workerIndex)
+{
+	std::vector<uint32_t>* visible = &visibleLists[workerIndex];
+	visible->clear();
+
+	uint32_t begin = std::min(workerIndex * chunkSize, objectCount);
+	uint32_t end = std::min(begin + chunkSize, objectCount);
+
+	switch (kernel)
+	{
+	case CullingKernel::Avx2:
+		cullSpheresAvx2(planes, *bounds, begin, end, visible);
+		break;
+	case CullingKernel::Sse:
+		cullSpheresSse(planes, *bounds, begin, end, visible);
+		break;
+	default:
+		cullSpheresScalar(planes, *bounds, begin, end, visible);
+		break;
+	}
+}
+
+void FrustumCuller::setKernel(CullingKernel kernel)
+{
+	this->kernel = kernel;
+}
+
+CullingKernel FrustumCuller::getKernel() const
+{
+	return kernel;
+}
+
+uint32_t FrustumCuller::getWorkerCount() const
+{
+	return workerPool.getWorkerCount();
+}
+
+const std::vector<std::vector<uint32_t>>& FrustumCuller::getVisibleLists() const
+{
+	return visibleLists;
+}
+
+uint32_t FrustumCuller::getVisibleCount() const
+{
+	size_t count = 0;
+
+	for (const std::vector<uint32_t>& visible : visibleLists)
+	{
+		count += visible.size();
+	}
+
+	return static_cast<uint32_t>(count);
+}
+
+// Gribb-Hartmann extraction for a zero-to-one depth range; planes are normalised so the distance can be
+// compared directly against a sphere radius.
+FrustumPlanes FrustumCuller::extractPlanes(const glm::mat4& viewProjection)
+{
+	glm::vec4 rows[4];
+
+	for (int i = 0; i < 4; ++i)
+	{
+		rows[i] = glm::vec4(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+	}
+
+	glm::vec4 extracted[6] = {
+		rows[3] + rows[0],
+		rows[3] - rows[0],
+		rows[3] + rows[1],
+		rows[3] - rows[1],
+		rows[2],
+		rows[3] - rows[2]
+	};
+
+	FrustumPlanes planes;
+
+	for (int p = 0; p < 6; ++p)
+	{
+		glm::vec4 plane = extracted[p];
+		float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+
+		planes.x[p] = plane.x / length;
+		planes.y[p] = plane.y / length;
+		planes.z[p] = plane.z / length;
+		planes.w[p] = plane.w / length;
+	}
+
+	return planes;
+}
+
+const char* FrustumCuller::getKernelName(CullingKernel kernel)
+{
+	switch (kernel)
+	{
+	case CullingKernel::Avx2:
+		return "avx2";
+	case CullingKernel::Sse:
+		return "sse";
+	default:
+		return "scalar";
+	}
+}
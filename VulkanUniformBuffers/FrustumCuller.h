@@ -0,0 +1,44 @@
+#pragma once
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+
+#include <cstdint>
+#include <vector>
+#include "glm/mat4x4.hpp"
+#include "FrustumPlanes.h"
+#include "InstanceBounds.h"
+#include "CullingKernel.h"
+#include "WorkerPool.h"
+
+
+class FrustumCuller
+{
+private:
+	const uint32_t MIN_OBJECTS_PER_WORKER = 4096;
+
+	CullingKernel kernel;
+	WorkerPool workerPool;
+
+	FrustumPlanes planes;
+	const InstanceBounds* bounds;
+	uint32_t objectCount;
+	uint32_t activeWorkerCount;
+	uint32_t chunkSize;
+	std::vector<std::vector<uint32_t>> visibleLists;
+
+	void cullChunk(uint32_t workerIndex);
+
+public:
+	FrustumCuller(uint32_t workerCount);
+
+	void cull(const glm::mat4& viewProjection, const InstanceBounds& bounds);
+	void setKernel(CullingKernel kernel);
+	CullingKernel getKernel() const;
+	uint32_t getWorkerCount() const;
+	const std::vector<std::vector<uint32_t>>& getVisibleLists() const;
+	uint32_t getVisibleCount() const;
+
+	static FrustumPlanes extractPlanes(const glm::mat4& viewProjection);
+	static const char* getKernelName(CullingKernel kernel);
+};
@@ -0,0 +1,10 @@
+#pragma once
+
+
+struct FrustumPlanes
+{
+	float x[6];
+	float y[6];
+	float z[6];
+	float w[6];
+};
@@ -0,0 +1,190 @@
+#include "GpuProfiler.h"
+#include "PhysicalDevice.h"
+#include "Device.h"
+#include <stdexcept>
+
+
+GpuProfiler::GpuProfiler(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
+	uint32_t slotCount)
+{
+	this->device = device;
+	this->slotCount = slotCount;
+
+	uint32_t validBits = physicalDevice->getGraphicsQueueFamilyProperties().timestampValidBits;
+	timestampPeriodNs = physicalDevice->getProperties().limits.timestampPeriod;
+	timestampMask = validBits >= 64 ? UINT64_MAX : (1ull << validBits) - 1;
+	vkQueryPool = VK_NULL_HANDLE;
+
+	if (validBits > 0)
+	{
+		createQueryPool();
+	}
+}
+
+GpuProfiler::~GpuProfiler()
+{
+	destroyQueryPool();
+}
+
+void GpuProfiler::createQueryPool()
+{
+	VkQueryPoolCreateInfo createInfo = {};
+	createInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+	createInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+	createInfo.queryCount = slotCount * MAX_REGIONS * 2;
+
+	VkResult result = vkCreateQueryPool(device->getHandle(), &createInfo, nullptr, &vkQueryPool);
+	throwIfCreateQueryPoolFailed(result);
+
+	submittedSlots.assign(slotCount, false);
+}
+
+void GpuProfiler::destroyQueryPool()
+{
+	vkDestroyQueryPool(device->getHandle(), vkQueryPool, nullptr);
+	vkQueryPool = VK_NULL_HANDLE;
+}
+
+void GpuProfiler::resize(uint32_t slotCount)
+{
+	if (!isSupported() || slotCount == this->slotCount)
+	{
+		return;
+	}
+
+	destroyQueryPool();
+	this->slotCount = slotCount;
+	createQueryPool();
+}
+
+void GpuProfiler::resetQueries(VkCommandBuffer commandBuffer, uint32_t slot)
+{
+	if (isSupported())
+	{
+		vkCmdResetQueryPool(commandBuffer, vkQueryPool, getQueryIndex(slot, 0), MAX_REGIONS * 2);
+	}
+}
+
+void GpuProfiler::beginRegion(VkCommandBuffer commandBuffer, uint32_t slot, const std::string& name)
+{
+	if (isSupported())
+	{
+		vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, vkQueryPool,
+			getQueryIndex(slot, findOrAddRegion(name)));
+	}
+}
+
+void GpuProfiler::endRegion(VkCommandBuffer commandBuffer, uint32_t slot, const std::string& name)
+{
+	if (isSupported())
+	{
+		vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, vkQueryPool,
+			getQueryIndex(slot, findOrAddRegion(name)) + 1);
+	}
+}
+
+void GpuProfiler::markSubmitted(uint32_t slot)
+{
+	if (isSupported())
+	{
+		submittedSlots[slot] = true;
+	}
+}
+
+void GpuProfiler::collectResults(uint32_t slot)
+{
+	if (!isSupported() || !submittedSlots[slot] || regionNames.empty())
+	{
+		return;
+	}
+
+	uint32_t queryCount = static_cast<uint32_t>(regionNames.size()) * 2;
+	std::vector<uint64_t> results(queryCount * 2);
+
+	// No WAIT flag: regions that are not available yet (or were never written for this slot) are skipped.
+	vkGetQueryPoolResults(device->getHandle(), vkQueryPool, getQueryIndex(slot, 0), queryCount,
+		results.size() * sizeof(uint64_t), results.data(), 2 * sizeof(uint64_t),
+		VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+
+	for (uint32_t region = 0; region < regionNames.size(); ++region)
+	{
+		addRegionSample(region, &results[region * 4], &results[region * 4 + 2]);
+	}
+
+	submittedSlots[slot] = false;
+}
+
+void GpuProfiler::addRegionSample(uint32_t region, const uint64_t* beginResult, const uint64_t* endResult)
+{
+	bool available = beginResult[1] != 0 && endResult[1] != 0;
+
+	if (available)
+	{
+		uint64_t ticks = (endResult[0] - beginResult[0]) & timestampMask;
+		regionTimers[region].addSample(ticks * timestampPeriodNs / 1000000.0);
+	}
+}
+
+void GpuProfiler::resetStats()
+{
+	for (FrameTimer& regionTimer : regionTimers)
+	{
+		regionTimer.reset();
+	}
+}
+
+bool GpuProfiler::isSupported() const
+{
+	return vkQueryPool != VK_NULL_HANDLE;
+}
+
+std::vector<GpuRegionStats> GpuProfiler::getStats() const
+{
+	std::vector<GpuRegionStats> stats;
+
+	for (size_t i = 0; i < regionNames.size(); ++i)
+	{
+		stats.push_back({ regionNames[i], regionTimers[i].getStats() });
+	}
+
+	return stats;
+}
+
+uint32_t GpuProfiler::findOrAddRegion(const std::string& name)
+{
+	for (uint32_t i = 0; i < regionNames.size(); ++i)
+	{
+		if (regionNames[i] == name)
+		{
+			return i;
+		}
+	}
+
+	throwIfTooManyRegions();
+
+	regionNames.push_back(name);
+	regionTimers.emplace_back();
+
+	return static_cast<uint32_t>(regionNames.size() - 1);
+}
+
+uint32_t GpuProfiler::getQueryIndex(uint32_t slot, uint32_t region) const
+{
+	return (slot * MAX_REGIONS + region) * 2;
+}
+
+void GpuProfiler::throwIfCreateQueryPoolFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create timestamp query pool.");
+	}
+}
+
+void GpuProfiler::throwIfTooManyRegions() const
+{
+	if (regionNames.size() == MAX_REGIONS)
+	{
+		throw std::runtime_error("Too many GPU profiler regions.");
+	}
+}
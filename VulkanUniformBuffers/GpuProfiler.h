@@ -0,0 +1,50 @@
+#pragma once
+
+#include <vulkan.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "FrameTimer.h"
+#include "GpuRegionStats.h"
+
+
+class PhysicalDevice;
+class Device;
+
+
+class GpuProfiler
+{
+private:
+	const uint32_t MAX_REGIONS = 16;
+
+	std::shared_ptr<Device> device;
+	VkQueryPool vkQueryPool;
+	double timestampPeriodNs;
+	uint64_t timestampMask;
+	uint32_t slotCount;
+	std::vector<std::string> regionNames;
+	std::vector<FrameTimer> regionTimers;
+	std::vector<bool> submittedSlots;
+
+	void createQueryPool();
+	void destroyQueryPool();
+	uint32_t findOrAddRegion(const std::string& name);
+	uint32_t getQueryIndex(uint32_t slot, uint32_t region) const;
+	void addRegionSample(uint32_t region, const uint64_t* beginResult, const uint64_t* endResult);
+	void throwIfCreateQueryPoolFailed(VkResult result) const;
+	void throwIfTooManyRegions() const;
+
+public:
+	GpuProfiler(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device, uint32_t slotCount);
+	~GpuProfiler();
+
+	void resize(uint32_t slotCount);
+	void resetQueries(VkCommandBuffer commandBuffer, uint32_t slot);
+	void beginRegion(VkCommandBuffer commandBuffer, uint32_t slot, const std::string& name);
+	void endRegion(VkCommandBuffer commandBuffer, uint32_t slot, const std::string& name);
+	void markSubmitted(uint32_t slot);
+	void collectResults(uint32_t slot);
+	void resetStats();
+	bool isSupported() const;
+	std::vector<GpuRegionStats> getStats() const;
+};
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <string>
+#include "FrameStats.h"
+
+
+struct GpuRegionStats
+{
+	std::string name;
+	FrameStats stats;
+};
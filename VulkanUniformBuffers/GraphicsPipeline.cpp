@@ -1,20 +1,31 @@
 #include "GraphicsPipeline.h"
-#include "SwapChain.h"
 #include "DescriptorSetLayout.h"
 #include "Device.h"
 #include "RenderPass.h"
 #include "Vertex.h"
-#include <fstream>
+#include "ObjectPushConstants.h"
+#include "InstanceData.h"
+#include "PipelineCache.h"
+#include <chrono>
+#include "ShaderPack.h"
 #include <vector>
 
 
-GraphicsPipeline::GraphicsPipeline(std::shared_ptr<Device> device, std::shared_ptr<SwapChain> swapChain,
-	std::shared_ptr<RenderPass> renderPass, std::shared_ptr<DescriptorSetLayout> descriptorSetLayout)
+GraphicsPipeline::GraphicsPipeline(std::shared_ptr<Device> device, std::shared_ptr<RenderPass> renderPass,
+	std::shared_ptr<DescriptorSetLayout> descriptorSetLayout, std::shared_ptr<PipelineCache> pipelineCache,
+	std::shared_ptr<ShaderPack> shaderPack, VertexTransformMode vertexTransformMode)
 {
 	this->device = device;
 	this->renderPass = renderPass;
+	this->pipelineCache = pipelineCache;
+	this->shaderPack = shaderPack;
 
-	VkShaderModule vertexShader = loadShader("vertex.spv");
+	pushConstantRange = buildPushConstantRange();
+	VkPipelineLayoutCreateInfo pipelineLayoutInfo = buildPipelineLayoutCreateInfo(descriptorSetLayout);
+	VkResult result = createPipelineLayout(&pipelineLayoutInfo);
+	throwIfCreatePipelineLayoutFailed(result);
+
+	VkShaderModule vertexShader = loadShader(getVertexShaderName(vertexTransformMode));
 	VkShaderModule fragmentShader = loadShader("fragment.spv");
 
 	VkPipelineShaderStageCreateInfo vertexStageCreateInfo = buildVertexStageCreateInfo(vertexShader);
@@ -22,26 +33,20 @@ GraphicsPipeline::GraphicsPipeline(std::shared_ptr<Device> device, std::shared_p
 	shaderStageInfos[0] = vertexStageCreateInfo;
 	shaderStageInfos[1] = fragmentStageCreateInfo;
 
-	const VkVertexInputBindingDescription vertexBindingDesc = buildVertexBindingDescription();
-	const std::array<VkVertexInputAttributeDescription, 2> vertexAttributeDesc = buildVertexAttributeDescription();
+	const std::array<VkVertexInputBindingDescription, 2> vertexBindingDesc = buildVertexBindingDescription();
+	const std::array<VkVertexInputAttributeDescription, 7> vertexAttributeDesc = buildVertexAttributeDescription();
 
 	vertexInputInfo = buildVertexInputStateCreateInfo(&vertexBindingDesc, &vertexAttributeDesc);
 	inputAssemblyCreateInfo = buildInputAssemblyStateCreateInfo();
 	
-	VkViewport viewport = buildViewport(swapChain);
-	VkRect2D scissor = buildScissor(swapChain);
-	viewportStateCreateInfo = buildViewportStateCreateInfo(&viewport, &scissor);
+	viewportStateCreateInfo = buildViewportStateCreateInfo();
+	dynamicStateCreateInfo = buildDynamicStateCreateInfo();
 
 	rasterizationStateCreateInfo = buildRasterizationStateCreateInfo();
 	multisamplingStateCreateInfo = buildMultisampleStateCreateInfo();
 	VkPipelineColorBlendAttachmentState colorBlendAttachment = buildColorBlendAttachmentState();
 
 	colorBlendState = buildColorBlendAttachmentStateCreateInfo(&colorBlendAttachment);
-
-	VkPipelineLayoutCreateInfo pipelineLayoutInfo = buildPipelineLayoutCreateInfo(descriptorSetLayout);
-	VkResult result = createPipelineLayout(&pipelineLayoutInfo);
-	throwIfCreatePipelineLayoutFailed(result);
-
 	depthStencilStateCreateInfo = buildDepthStencilStateCreateInfo();
 
 	VkGraphicsPipelineCreateInfo pipelineInfo = buildPipelineCreateInfo();
@@ -85,51 +90,38 @@ VkPipelineInputAssemblyStateCreateInfo GraphicsPipeline::buildInputAssemblyState
 	return createInfo;
 }
 
-VkViewport GraphicsPipeline::buildViewport(std::shared_ptr<SwapChain> swapChain) const
-{
-	VkViewport viewport = {};
-	viewport.x = 0.0f;
-	viewport.y = 0.0f;
-	viewport.width = static_cast<float>(swapChain->getSwapChainExtent().width);
-	viewport.height = static_cast<float>(swapChain->getSwapChainExtent().height);
-	viewport.minDepth = 0.0f;
-	viewport.maxDepth = 1.0f;
-
-	return viewport;
-}
-
-VkRect2D GraphicsPipeline::buildScissor(std::shared_ptr<SwapChain> swapChain) const
-{
-	VkRect2D scissor = {};
-	scissor.extent = swapChain->getSwapChainExtent();
-	scissor.offset = { 0, 0 };
-
-	return scissor;
-}
-
 VkPipelineVertexInputStateCreateInfo GraphicsPipeline::buildVertexInputStateCreateInfo(
-	const VkVertexInputBindingDescription* vertexBindingDesc, 
-	const std::array<VkVertexInputAttributeDescription, 2>* vertexAttributeDesc) const
+	const std::array<VkVertexInputBindingDescription, 2>* vertexBindingDesc,
+	const std::array<VkVertexInputAttributeDescription, 7>* vertexAttributeDesc) const
 {
 	VkPipelineVertexInputStateCreateInfo createInfo = {};
 	createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-	createInfo.pVertexBindingDescriptions = vertexBindingDesc;
-	createInfo.vertexBindingDescriptionCount = 1;
+	createInfo.pVertexBindingDescriptions = vertexBindingDesc->data();
+	createInfo.vertexBindingDescriptionCount = static_cast<uint32_t>(vertexBindingDesc->size());
 	createInfo.pVertexAttributeDescriptions = vertexAttributeDesc->data();
 	createInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(vertexAttributeDesc->size());
 
 	return createInfo;
 }
 
-VkPipelineViewportStateCreateInfo GraphicsPipeline::buildViewportStateCreateInfo(VkViewport* viewport,
-	VkRect2D* scissor) const
+VkPipelineViewportStateCreateInfo GraphicsPipeline::buildViewportStateCreateInfo() const
 {
 	VkPipelineViewportStateCreateInfo createInfo = {};
 	createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
 	createInfo.viewportCount = 1;
-	createInfo.pViewports = viewport;
+	createInfo.pViewports = nullptr;
 	createInfo.scissorCount = 1;
-	createInfo.pScissors = scissor;
+	createInfo.pScissors = nullptr;
+
+	return createInfo;
+}
+
+VkPipelineDynamicStateCreateInfo GraphicsPipeline::buildDynamicStateCreateInfo() const
+{
+	VkPipelineDynamicStateCreateInfo createInfo = {};
+	createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+	createInfo.dynamicStateCount = static_cast<uint32_t>(dynamicStates.size());
+	createInfo.pDynamicStates = dynamicStates.data();
 
 	return createInfo;
 }
@@ -197,6 +189,16 @@ VkPipelineColorBlendStateCreateInfo GraphicsPipeline::buildColorBlendAttachmentS
 	return createInfo;
 }
 
+VkPushConstantRange GraphicsPipeline::buildPushConstantRange() const
+{
+	VkPushConstantRange range = {};
+	range.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+	range.offset = 0;
+	range.size = sizeof(ObjectPushConstants);
+
+	return range;
+}
+
 VkPipelineLayoutCreateInfo GraphicsPipeline::buildPipelineLayoutCreateInfo(
 	std::shared_ptr<DescriptorSetLayout> descriptorSetLayout) const
 {
@@ -204,6 +206,8 @@ VkPipelineLayoutCreateInfo GraphicsPipeline::buildPipelineLayoutCreateInfo(
 	pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
 	pipelineLayoutInfo.setLayoutCount = 1;
 	pipelineLayoutInfo.pSetLayouts = descriptorSetLayout->getHandlePtr();
+	pipelineLayoutInfo.pushConstantRangeCount = 1;
+	pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
 
 	return pipelineLayoutInfo;
 }
@@ -214,25 +218,24 @@ GraphicsPipeline::~GraphicsPipeline()
 	vkDestroyPipelineLayout(device->getHandle(), vkPipelineLayout, nullptr);
 }
 
-VkShaderModule GraphicsPipeline::loadShader(const char* fileName)
+const char* GraphicsPipeline::getVertexShaderName(VertexTransformMode vertexTransformMode) const
 {
-	std::ifstream istr(fileName, std::ios::ate | std::ios::binary);
-
-	if (!istr.is_open())
+	if (vertexTransformMode == VertexTransformMode::Separate)
 	{
-		throw std::runtime_error("Failed to open shader file.");
+		return "vertex.spv";
 	}
 
-	size_t fileSize = static_cast<size_t>(istr.tellg());
-	std::vector<char> buffer(fileSize);
-	istr.seekg(0);
-	istr.read(buffer.data(), fileSize);
-	istr.close();
+	return "vertex_premultiplied.spv";
+}
+
+VkShaderModule GraphicsPipeline::loadShader(const char* name)
+{
+	ShaderCode shaderCode = shaderPack->getShaderCode(name);
 
 	VkShaderModuleCreateInfo shaderModuleCreateInfo = {};
 	shaderModuleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-	shaderModuleCreateInfo.codeSize = fileSize;
-	shaderModuleCreateInfo.pCode = reinterpret_cast<uint32_t*>(buffer.data());
+	shaderModuleCreateInfo.codeSize = shaderCode.size;
+	shaderModuleCreateInfo.pCode = shaderCode.code;
 
 	VkShaderModule shaderModule;
 	VkResult result = vkCreateShaderModule(device->getHandle(), &shaderModuleCreateInfo, nullptr, &shaderModule);
@@ -244,18 +247,24 @@ VkShaderModule GraphicsPipeline::loadShader(const char* fileName)
 	return shaderModule;
 }
 
-VkVertexInputBindingDescription GraphicsPipeline::buildVertexBindingDescription()
+std::array<VkVertexInputBindingDescription, 2> GraphicsPipeline::buildVertexBindingDescription()
 {
-	VkVertexInputBindingDescription bindingDescription = {};
-	bindingDescription.binding = 0;
-	bindingDescription.stride = sizeof(Vertex);
-	bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-	return bindingDescription;
+	std::array<VkVertexInputBindingDescription, 2> bindingDescriptions = {};
+
+	bindingDescriptions[0].binding = 0;
+	bindingDescriptions[0].stride = sizeof(Vertex);
+	bindingDescriptions[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+
+	bindingDescriptions[1].binding = 1;
+	bindingDescriptions[1].stride = sizeof(InstanceData);
+	bindingDescriptions[1].inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+
+	return bindingDescriptions;
 }
 
-std::array<VkVertexInputAttributeDescription, 2> GraphicsPipeline::buildVertexAttributeDescription()
+std::array<VkVertexInputAttributeDescription, 7> GraphicsPipeline::buildVertexAttributeDescription()
 {
-	std::array<VkVertexInputAttributeDescription, 2> attributeDescriptions = {};
+	std::array<VkVertexInputAttributeDescription, 7> attributeDescriptions = {};
 
 	attributeDescriptions[0].binding = 0;
 	attributeDescriptions[0].location = 0;
@@ -267,6 +276,20 @@ std::array<VkVertexInputAttributeDescription, 2> GraphicsPipeline::buildVertexAt
 	attributeDescriptions[1].format = VK_FORMAT_R32G32B32_SFLOAT;
 	attributeDescriptions[1].offset = offsetof(Vertex, color);
 
+	for (uint32_t column = 0; column < 4; ++column)
+	{
+		attributeDescriptions[2 + column].binding = 1;
+		attributeDescriptions[2 + column].location = 2 + column;
+		attributeDescriptions[2 + column].format = VK_FORMAT_R32G32B32A32_SFLOAT;
+		attributeDescriptions[2 + column].offset = static_cast<uint32_t>(offsetof(InstanceData, model) +
+			sizeof(glm::vec4) * column);
+	}
+
+	attributeDescriptions[6].binding = 1;
+	attributeDescriptions[6].location = 6;
+	attributeDescriptions[6].format = VK_FORMAT_R32G32B32A32_SFLOAT;
+	attributeDescriptions[6].offset = offsetof(InstanceData, color);
+
 	return attributeDescriptions;
 }
 
@@ -306,7 +329,7 @@ VkGraphicsPipelineCreateInfo GraphicsPipeline::buildPipelineCreateInfo() const
 	createInfo.pMultisampleState = &multisamplingStateCreateInfo;
 	createInfo.pDepthStencilState = &depthStencilStateCreateInfo;
 	createInfo.pColorBlendState = &colorBlendState;
-	createInfo.pDynamicState = nullptr;
+	createInfo.pDynamicState = &dynamicStateCreateInfo;
 	createInfo.layout = vkPipelineLayout;
 	createInfo.renderPass = renderPass->getHandle();
 	createInfo.subpass = 0;
@@ -318,7 +341,14 @@ VkGraphicsPipelineCreateInfo GraphicsPipeline::buildPipelineCreateInfo() const
 
 VkResult GraphicsPipeline::createPipeline(VkGraphicsPipelineCreateInfo* pipelineInfo)
 {
-	return vkCreateGraphicsPipelines(device->getHandle(), VK_NULL_HANDLE, 1, pipelineInfo, nullptr, &vkPipeline);
+	using namespace std::chrono;
+
+	high_resolution_clock::time_point startTime = high_resolution_clock::now();
+	VkResult result = vkCreateGraphicsPipelines(device->getHandle(), pipelineCache->getHandle(), 1, pipelineInfo,
+		nullptr, &vkPipeline);
+	creationTimeMs = duration<double, std::milli>(high_resolution_clock::now() - startTime).count();
+
+	return result;
 }
 
 void GraphicsPipeline::throwIfCreatePipelineFailed(VkResult result)
@@ -342,4 +372,9 @@ VkPipelineLayout GraphicsPipeline::getLayoutHandle() const
 VkPipeline GraphicsPipeline::getHandle() const
 {
 	return vkPipeline;
+}
+
+double GraphicsPipeline::getCreationTimeMs() const
+{
+	return creationTimeMs;
 }
\ No newline at end of file
@@ -3,12 +3,14 @@
 #include <vulkan.h>
 #include <memory>
 #include <array>
+#include "VertexTransformMode.h"
 
 
-class SwapChain;
 class DescriptorSetLayout;
 class Device;
 class RenderPass;
+class PipelineCache;
+class ShaderPack;
 
 
 class GraphicsPipeline
@@ -16,33 +18,37 @@ class GraphicsPipeline
 private:
 	std::shared_ptr<Device> device;
 	std::shared_ptr<RenderPass> renderPass;
+	std::shared_ptr<PipelineCache> pipelineCache;
+	std::shared_ptr<ShaderPack> shaderPack;
+	double creationTimeMs;
+	VkPushConstantRange pushConstantRange;
 	VkPipelineLayout vkPipelineLayout;
 	VkPipeline vkPipeline;
 	VkPipelineShaderStageCreateInfo shaderStageInfos[2];
 	VkPipelineVertexInputStateCreateInfo vertexInputInfo;
 	VkPipelineInputAssemblyStateCreateInfo inputAssemblyCreateInfo;
 	VkPipelineViewportStateCreateInfo viewportStateCreateInfo;
+	const std::array<VkDynamicState, 2> dynamicStates = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+	VkPipelineDynamicStateCreateInfo dynamicStateCreateInfo;
 	VkPipelineRasterizationStateCreateInfo rasterizationStateCreateInfo;
 	VkPipelineMultisampleStateCreateInfo multisamplingStateCreateInfo;
 	VkPipelineDepthStencilStateCreateInfo depthStencilStateCreateInfo;
 	VkPipelineColorBlendStateCreateInfo colorBlendState;
 
-	VkShaderModule loadShader(const char* fileName);
+	VkShaderModule loadShader(const char* name);
+	const char* getVertexShaderName(VertexTransformMode vertexTransformMode) const;
 
 	VkPipelineShaderStageCreateInfo buildVertexStageCreateInfo(VkShaderModule vertexShader) const;
 	VkPipelineShaderStageCreateInfo buildFragmentStageCreateInfo(VkShaderModule fragmentShader) const;
-	VkVertexInputBindingDescription buildVertexBindingDescription();
+	std::array<VkVertexInputBindingDescription, 2> buildVertexBindingDescription();
 
 	VkPipelineVertexInputStateCreateInfo buildVertexInputStateCreateInfo(
-		const VkVertexInputBindingDescription* vertexBindingDesc,
-		const std::array<VkVertexInputAttributeDescription, 2>* vertexAttributeDesc) const;
+		const std::array<VkVertexInputBindingDescription, 2>* vertexBindingDesc,
+		const std::array<VkVertexInputAttributeDescription, 7>* vertexAttributeDesc) const;
 
 	VkPipelineInputAssemblyStateCreateInfo buildInputAssemblyStateCreateInfo() const;
-	VkViewport buildViewport(std::shared_ptr<SwapChain> swapChain) const;
-	VkRect2D buildScissor(std::shared_ptr<SwapChain> swapChain) const;
-
-	VkPipelineViewportStateCreateInfo buildViewportStateCreateInfo(VkViewport* viewport,
-		VkRect2D* scissor) const;
+	VkPipelineViewportStateCreateInfo buildViewportStateCreateInfo() const;
+	VkPipelineDynamicStateCreateInfo buildDynamicStateCreateInfo() const;
 
 	VkPipelineRasterizationStateCreateInfo buildRasterizationStateCreateInfo() const;
 	VkPipelineMultisampleStateCreateInfo buildMultisampleStateCreateInfo() const;
@@ -51,10 +57,12 @@ private:
 	VkPipelineColorBlendStateCreateInfo buildColorBlendAttachmentStateCreateInfo(
 		VkPipelineColorBlendAttachmentState* colorBlendAttachmentState) const;
 
+	VkPushConstantRange buildPushConstantRange() const;
+
 	VkPipelineLayoutCreateInfo buildPipelineLayoutCreateInfo(
 		std::shared_ptr<DescriptorSetLayout> descriptorSetLayout) const;
 
-	std::array<VkVertexInputAttributeDescription, 2> buildVertexAttributeDescription();
+	std::array<VkVertexInputAttributeDescription, 7> buildVertexAttributeDescription();
 	VkResult createPipelineLayout(VkPipelineLayoutCreateInfo* pipelineLayoutInfo);
 	void throwIfCreatePipelineLayoutFailed(VkResult result);
 	VkPipelineDepthStencilStateCreateInfo buildDepthStencilStateCreateInfo() const;
@@ -64,11 +72,13 @@ private:
 	void destroyShader(VkShaderModule shader) const;
 
 public:
-	GraphicsPipeline(std::shared_ptr<Device> device, std::shared_ptr<SwapChain> swapChain,
-		std::shared_ptr<RenderPass> renderPass, std::shared_ptr<DescriptorSetLayout> descriptorSetLayout);
+	GraphicsPipeline(std::shared_ptr<Device> device, std::shared_ptr<RenderPass> renderPass,
+		std::shared_ptr<DescriptorSetLayout> descriptorSetLayout, std::shared_ptr<PipelineCache> pipelineCache,
+		std::shared_ptr<ShaderPack> shaderPack, VertexTransformMode vertexTransformMode);
 
 	~GraphicsPipeline();
 
 	VkPipelineLayout getLayoutHandle() const;
 	VkPipeline getHandle() const;
+	double getCreationTimeMs() const;
 };
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <iostream>
+#include "HeadlessRunner.h"
+#include "UniformBenchmark.h"
+#include "StatsPrinter.h"
+
+
+HeadlessRunner::HeadlessRunner(std::shared_ptr<Engine> engine)
+{
+	this->engine = engine;
+	this->engine->initHeadless(IMAGE_WIDTH, IMAGE_HEIGHT);
+}
+
+HeadlessRunner::~HeadlessRunner()
+{
+	engine->cleanUp();
+}
+
+void HeadlessRunner::run(int frameCount)
+{
+	renderFrames(WARM_UP_FRAME_COUNT);
+	engine->resetFrameStats();
+	renderFrames(frameCount);
+
+	printFrameStats("headless " + std::to_string(IMAGE_WIDTH) + "x" + std::to_string(IMAGE_HEIGHT)
+		+ ", frames in flight: " + std::to_string(engine->getFramesInFlight()), engine->getFrameStats());
+	printGpuStats(engine->getGpuStats());
+
+	if (engine->isPerFrameRecordingActive())
+	{
+		printRecordingStats(engine->getRecordingStats());
+	}
+}
+
+void HeadlessRunner::runUniformBenchmark(int frameCount)
+{
+	const std::vector<uint32_t> objectCounts = { 1, 10, 100, 1000, 10000, 100000 };
+
+	printUniformBenchmarkResults(engine->runUniformBenchmark(objectCounts, static_cast<uint32_t>(frameCount)));
+}
+
+void HeadlessRunner::renderFrames(int frameCount)
+{
+	for (int i = 0; i < frameCount; ++i)
+	{
+		engine->update();
+		engine->render();
+	}
+}
+
+void HeadlessRunner::printUniformBenchmarkResults(const std::vector<UniformBenchmarkResult>& results) const
+{
+	std::cout << "strategy,objects,update_record_avg_ms,update_record_p95_ms,submit_consume_wait_avg_ms,"
+		"submit_consume_wait_p95_ms" << std::endl;
+
+	for (const UniformBenchmarkResult& result : results)
+	{
+		std::cout << UniformBenchmark::getStrategyName(result.strategy)
+			<< "," << result.objectCount
+			<< "," << result.recordStats.averageMs
+			<< "," << result.recordStats.p95Ms
+			<< "," << result.consumeStats.averageMs
+			<< "," << result.consumeStats.p95Ms << std::endl;
+	}
+}
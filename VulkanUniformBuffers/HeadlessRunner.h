@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "Engine.h"
+
+
+class HeadlessRunner
+{
+private:
+	const uint32_t IMAGE_WIDTH = 800;
+	const uint32_t IMAGE_HEIGHT = 600;
+	const int WARM_UP_FRAME_COUNT = 60;
+
+	std::shared_ptr<Engine> engine;
+
+	void renderFrames(int frameCount);
+	void printUniformBenchmarkResults(const std::vector<UniformBenchmarkResult>& results) const;
+
+public:
+	HeadlessRunner(std::shared_ptr<Engine> engine);
+	~HeadlessRunner();
+	void run(int frameCount);
+	void runUniformBenchmark(int frameCount);
+};
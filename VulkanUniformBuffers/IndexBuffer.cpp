@@ -1,50 +1,23 @@
 #include "IndexBuffer.h"
 #include "PhysicalDevice.h"
 #include "Device.h"
-#include "CommandPool.h"
+#include "UploadManager.h"
 
 IndexBuffer::IndexBuffer(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
-	std::shared_ptr<CommandPool> commandPool)
-	: Buffer(physicalDevice, device)
+	std::shared_ptr<MemoryAllocator> memoryAllocator, std::shared_ptr<UploadManager> uploadManager)
+	: Buffer(physicalDevice, device, memoryAllocator)
 {
 	indices = buildIndices();
-	VkBuffer stagingBuffer;
-	VkDeviceMemory stagingMemory;
 
 	const VkDeviceSize bufferSize = sizeof(uint32_t) * indices.size();
-	const VkBufferUsageFlags stagingBufferUsageFlags = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-	const VkMemoryPropertyFlags stagingMemPropertyFlags = VK_MEMORY_PROPERTY_HOST_COHERENT_BIT |
-		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
-
-	createBuffer(bufferSize, stagingBufferUsageFlags, stagingMemPropertyFlags,
-		&stagingBuffer, &stagingMemory);
-
-	void* mappedMemory;
-	VkResult result = vkMapMemory(device->getHandle(), stagingMemory, 0, bufferSize, 0, &mappedMemory);
-	throwIfMapMemoryFailed(result);
-
-	memcpy(mappedMemory, indices.data(), bufferSize);
-	vkUnmapMemory(device->getHandle(), stagingMemory);
-
 	const VkBufferUsageFlags indexBufferUsageFlags = VK_BUFFER_USAGE_TRANSFER_DST_BIT |
 		VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
 	const VkMemoryPropertyFlags indexMemPropertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
 
 	createBuffer(bufferSize, indexBufferUsageFlags, indexMemPropertyFlags, &vkIndexBuffer,
-		&vkIndexDeviceMemory);
+		&indexAllocation);
 
-	copyBuffer(commandPool, bufferSize, stagingBuffer, vkIndexBuffer);
-
-	vkDestroyBuffer(device->getHandle(), stagingBuffer, nullptr);
-	vkFreeMemory(device->getHandle(), stagingMemory, nullptr);
-}
-
-void IndexBuffer::throwIfMapMemoryFailed(VkResult result) const
-{
-	if (result != VK_SUCCESS)
-	{
-		throw std::runtime_error("Failed to map index memory.");
-	}
+	uploadManager->upload(vkIndexBuffer, 0, indices.data(), bufferSize);
 }
 
 std::vector<uint32_t> IndexBuffer::buildIndices() const
@@ -65,8 +38,7 @@ VkBuffer IndexBuffer::getHandle() const
 
 IndexBuffer::~IndexBuffer()
 {
-	vkDestroyBuffer(device->getHandle(), vkIndexBuffer, nullptr);
-	vkFreeMemory(device->getHandle(), vkIndexDeviceMemory, nullptr);
+	destroyBuffer(vkIndexBuffer, indexAllocation);
 }
 
 uint32_t IndexBuffer::getIndicesCount() const
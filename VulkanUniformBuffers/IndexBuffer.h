@@ -6,21 +6,21 @@
 
 class PhysicalDevice;
 class Device;
-class CommandPool;
+class UploadManager;
+class MemoryAllocator;
 
 class IndexBuffer : public Buffer
 {
 private:
 	std::vector<uint32_t> indices;
 	VkBuffer vkIndexBuffer;
-	VkDeviceMemory vkIndexDeviceMemory;
+	MemoryAllocation indexAllocation;
 
 	std::vector<uint32_t> buildIndices() const;
-	void throwIfMapMemoryFailed(VkResult result) const;
 
 public:
 	IndexBuffer(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
-		std::shared_ptr<CommandPool> commandPool);
+		std::shared_ptr<MemoryAllocator> memoryAllocator, std::shared_ptr<UploadManager> uploadManager);
 
 	VkBuffer getHandle() const;
 	uint32_t getIndicesCount() const;
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <vector>
+
+
+struct InstanceBounds
+{
+	std::vector<float> centerX;
+	std::vector<float> centerY;
+	std::vector<float> centerZ;
+	std::vector<float> radius;
+};
@@ -0,0 +1,312 @@
+#include "InstanceBuffer.h"
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
+#include <glm/glm.hpp>
+
+
+InstanceBuffer::InstanceBuffer(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
+	std::shared_ptr<MemoryAllocator> memoryAllocator, uint32_t frameCount, uint32_t capacity, uint32_t indexCount,
+	float meshRadius)
+	: Buffer(physicalDevice, device, memoryAllocator),
+	visibleObjectCount(0),
+	visibleCapacity(0),
+	version(1)
+{
+	this->frameCount = frameCount;
+	this->capacity = capacity;
+	this->indexCount = indexCount;
+	this->meshRadius = meshRadius;
+
+	instances.reserve(capacity);
+	instanceIds.reserve(capacity);
+	bounds.centerX.reserve(capacity);
+	bounds.centerY.reserve(capacity);
+	bounds.centerZ.reserve(capacity);
+	bounds.radius.reserve(capacity);
+
+	createInstanceBuffer();
+}
+
+InstanceBuffer::~InstanceBuffer()
+{
+	destroyBuffer(vkBuffer, allocation);
+}
+
+// Each swapchain image owns a slice holding the live instances followed by the indirect draw command, so the
+// instance count can change every frame without re-recording the command buffers. Once visible slices are
+// reserved, the slice continues with one region and one draw command per scene object for the CPU culler.
+void InstanceBuffer::createInstanceBuffer()
+{
+	frameSize = getVisibleOffset() + getVisibleInstancesSize() +
+		alignToFrame(sizeof(VkDrawIndexedIndirectCommand) * visibleObjectCount);
+
+	createHostVisibleBuffer(frameSize * frameCount,
+		VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+		&vkBuffer, &allocation);
+	throwIfNotMapped();
+
+	frameVersions.assign(frameCount, 0);
+}
+
+uint32_t InstanceBuffer::addInstance(const InstanceData& instanceData)
+{
+	throwIfFull();
+
+	uint32_t id;
+	if (freeIds.empty())
+	{
+		id = static_cast<uint32_t>(idToIndex.size());
+		idToIndex.push_back(INVALID_INDEX);
+	}
+	else
+	{
+		id = freeIds.back();
+		freeIds.pop_back();
+	}
+
+	idToIndex[id] = static_cast<uint32_t>(instances.size());
+	instances.push_back(instanceData);
+	instanceIds.push_back(id);
+
+	bounds.centerX.push_back(0.0f);
+	bounds.centerY.push_back(0.0f);
+	bounds.centerZ.push_back(0.0f);
+	bounds.radius.push_back(0.0f);
+	writeBounds(idToIndex[id], instanceData);
+	++version;
+
+	return id;
+}
+
+void InstanceBuffer::removeInstance(uint32_t id)
+{
+	throwIfInvalidId(id);
+
+	uint32_t index = idToIndex[id];
+	uint32_t lastIndex = static_cast<uint32_t>(instances.size() - 1);
+
+	if (index != lastIndex)
+	{
+		instances[index] = instances[lastIndex];
+		instanceIds[index] = instanceIds[lastIndex];
+		idToIndex[instanceIds[index]] = index;
+		writeBounds(index, instances[index]);
+	}
+
+	instances.pop_back();
+	instanceIds.pop_back();
+	bounds.centerX.pop_back();
+	bounds.centerY.pop_back();
+	bounds.centerZ.pop_back();
+	bounds.radius.pop_back();
+	idToIndex[id] = INVALID_INDEX;
+	freeIds.push_back(id);
+	++version;
+}
+
+void InstanceBuffer::updateInstance(uint32_t id, const InstanceData& instanceData)
+{
+	throwIfInvalidId(id);
+
+	instances[idToIndex[id]] = instanceData;
+	writeBounds(idToIndex[id], instanceData);
+	++version;
+}
+
+// Bounds are kept in instance space; the culler folds the scene object transform into its frustum planes.
+void InstanceBuffer::writeBounds(uint32_t index, const InstanceData& instanceData)
+{
+	const glm::mat4& model = instanceData.model;
+	float scale = std::max(glm::length(glm::vec3(model[0])),
+		std::max(glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2]))));
+
+	bounds.centerX[index] = model[3].x;
+	bounds.centerY[index] = model[3].y;
+	bounds.centerZ[index] = model[3].z;
+	bounds.radius[index] = meshRadius * scale;
+}
+
+void InstanceBuffer::writeFrame(uint32_t frameIndex)
+{
+	if (frameVersions[frameIndex] == version)
+	{
+		return;
+	}
+
+	char* frameData = static_cast<char*>(allocation.mappedData) + getInstanceOffset(frameIndex);
+	VkDeviceSize liveSize = sizeof(InstanceData) * instances.size();
+	memcpy(frameData, instances.data(), static_cast<size_t>(liveSize));
+
+	if (liveSize > 0)
+	{
+		flushHostVisibleBuffer(allocation, getInstanceOffset(frameIndex), liveSize);
+	}
+
+	writeDrawCommand(getIndirectCommandOffset(frameIndex), static_cast<uint32_t>(instances.size()));
+	frameVersions[frameIndex] = version;
+}
+
+// The visible set changes with the camera, so the object's slice is rewritten every frame.
+void InstanceBuffer::writeVisibleObject(uint32_t frameIndex, uint32_t objectIndex,
+	const std::vector<std::vector<uint32_t>>& visibleLists)
+{
+	throwIfVisibleFull();
+
+	VkDeviceSize instanceOffset = getVisibleInstanceOffset(frameIndex, objectIndex);
+	InstanceData* objectInstances = reinterpret_cast<InstanceData*>(
+		static_cast<char*>(allocation.mappedData) + instanceOffset);
+	uint32_t visibleCount = 0;
+
+	for (const std::vector<uint32_t>& visible : visibleLists)
+	{
+		for (uint32_t index : visible)
+		{
+			objectInstances[visibleCount++] = instances[index];
+		}
+	}
+
+	if (visibleCount > 0)
+	{
+		flushHostVisibleBuffer(allocation, instanceOffset, sizeof(InstanceData) * visibleCount);
+	}
+
+	writeDrawCommand(getVisibleCommandOffset(frameIndex, objectIndex), visibleCount);
+}
+
+void InstanceBuffer::writeDrawCommand(VkDeviceSize commandOffset, uint32_t instanceCount)
+{
+	VkDrawIndexedIndirectCommand drawCommand = {};
+	drawCommand.indexCount = indexCount;
+	drawCommand.instanceCount = instanceCount;
+	memcpy(static_cast<char*>(allocation.mappedData) + commandOffset, &drawCommand, sizeof(drawCommand));
+
+	flushHostVisibleBuffer(allocation, commandOffset, sizeof(drawCommand));
+}
+
+void InstanceBuffer::updateFrameCount(uint32_t frameCount)
+{
+	if (frameCount == this->frameCount)
+	{
+		return;
+	}
+
+	destroyBuffer(vkBuffer, allocation);
+	this->frameCount = frameCount;
+	createInstanceBuffer();
+}
+
+// Visible slices are sized for twice the live instances, so a growing scene does not reallocate every frame. The
+// caller must make sure the device no longer uses the buffer.
+void InstanceBuffer::reserveVisible(uint32_t objectCount)
+{
+	visibleObjectCount = objectCount;
+	visibleCapacity = std::min(std::max(static_cast<uint32_t>(instances.size()) * 2, MIN_VISIBLE_CAPACITY),
+		capacity);
+
+	destroyBuffer(vkBuffer, allocation);
+	createInstanceBuffer();
+}
+
+VkDeviceSize InstanceBuffer::getInstancesSize() const
+{
+	return alignToFrame(sizeof(InstanceData) * capacity);
+}
+
+VkDeviceSize InstanceBuffer::getVisibleOffset() const
+{
+	return alignToFrame(getInstancesSize() + sizeof(VkDrawIndexedIndirectCommand));
+}
+
+VkDeviceSize InstanceBuffer::getVisibleInstancesSize() const
+{
+	return alignToFrame(sizeof(InstanceData) * static_cast<VkDeviceSize>(visibleCapacity) * visibleObjectCount);
+}
+
+VkDeviceSize InstanceBuffer::alignToFrame(VkDeviceSize size) const
+{
+	return (size + FRAME_ALIGNMENT - 1) / FRAME_ALIGNMENT * FRAME_ALIGNMENT;
+}
+
+void InstanceBuffer::throwIfFull() const
+{
+	if (instances.size() >= capacity)
+	{
+		throw std::runtime_error("Instance buffer is full.");
+	}
+}
+
+void InstanceBuffer::throwIfVisibleFull() const
+{
+	if (instances.size() > visibleCapacity)
+	{
+		throw std::runtime_error("Visible instance slices are full.");
+	}
+}
+
+void InstanceBuffer::throwIfInvalidId(uint32_t id) const
+{
+	if (id >= idToIndex.size() || idToIndex[id] == INVALID_INDEX)
+	{
+		throw std::runtime_error("Invalid instance id.");
+	}
+}
+
+void InstanceBuffer::throwIfNotMapped() const
+{
+	if (allocation.mappedData == nullptr)
+	{
+		throw std::runtime_error("Instance buffer memory is not host visible.");
+	}
+}
+
+VkBuffer InstanceBuffer::getHandle() const
+{
+	return vkBuffer;
+}
+
+VkDeviceSize InstanceBuffer::getInstanceOffset(uint32_t frameIndex) const
+{
+	return frameSize * frameIndex;
+}
+
+VkDeviceSize InstanceBuffer::getIndirectCommandOffset(uint32_t frameIndex) const
+{
+	return getInstanceOffset(frameIndex) + getInstancesSize();
+}
+
+VkDeviceSize InstanceBuffer::getVisibleInstanceOffset(uint32_t frameIndex, uint32_t objectIndex) const
+{
+	return getInstanceOffset(frameIndex) + getVisibleOffset() + sizeof(InstanceData) * visibleCapacity * objectIndex;
+}
+
+VkDeviceSize InstanceBuffer::getVisibleCommandOffset(uint32_t frameIndex, uint32_t objectIndex) const
+{
+	return getInstanceOffset(frameIndex) + getVisibleOffset() + getVisibleInstancesSize() +
+		sizeof(VkDrawIndexedIndirectCommand) * objectIndex;
+}
+
+bool InstanceBuffer::hasVisibleObjects() const
+{
+	return visibleObjectCount > 0;
+}
+
+bool InstanceBuffer::hasVisibleCapacity() const
+{
+	return instances.size() <= visibleCapacity;
+}
+
+uint32_t InstanceBuffer::getInstanceCount() const
+{
+	return static_cast<uint32_t>(instances.size());
+}
+
+uint32_t InstanceBuffer::getCapacity() const
+{
+	return capacity;
+}
+
+const InstanceBounds& InstanceBuffer::getBounds() const
+{
+	return bounds;
+}
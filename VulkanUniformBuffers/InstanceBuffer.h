@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vulkan.h>
+#include <memory>
+#include <vector>
+#include "Buffer.h"
+#include "InstanceData.h"
+#include "InstanceBounds.h"
+
+
+class InstanceBuffer : public Buffer
+{
+private:
+	const uint32_t INVALID_INDEX = UINT32_MAX;
+	const VkDeviceSize FRAME_ALIGNMENT = 256;
+	const uint32_t MIN_VISIBLE_CAPACITY = 64;
+
+	VkBuffer vkBuffer;
+	MemoryAllocation allocation;
+	uint32_t capacity;
+	uint32_t frameCount;
+	uint32_t indexCount;
+	float meshRadius;
+	uint32_t visibleObjectCount;
+	uint32_t visibleCapacity;
+	VkDeviceSize frameSize;
+
+	std::vector<InstanceData> instances;
+	std::vector<uint32_t> instanceIds;
+	std::vector<uint32_t> idToIndex;
+	std::vector<uint32_t> freeIds;
+	InstanceBounds bounds;
+	uint64_t version;
+	std::vector<uint64_t> frameVersions;
+
+	void createInstanceBuffer();
+	VkDeviceSize getInstancesSize() const;
+	VkDeviceSize getVisibleOffset() const;
+	VkDeviceSize getVisibleInstancesSize() const;
+	VkDeviceSize alignToFrame(VkDeviceSize size) const;
+	void writeBounds(uint32_t index, const InstanceData& instanceData);
+	void writeDrawCommand(VkDeviceSize commandOffset, uint32_t instanceCount);
+	void throwIfFull() const;
+	void throwIfVisibleFull() const;
+	void throwIfInvalidId(uint32_t id) const;
+	void throwIfNotMapped() const;
+
+public:
+	InstanceBuffer(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
+		std::shared_ptr<MemoryAllocator> memoryAllocator, uint32_t frameCount, uint32_t capacity, uint32_t indexCount,
+		float meshRadius);
+
+	~InstanceBuffer();
+
+	uint32_t addInstance(const InstanceData& instanceData);
+	void removeInstance(uint32_t id);
+	void updateInstance(uint32_t id, const InstanceData& instanceData);
+	void writeFrame(uint32_t frameIndex);
+	void writeVisibleObject(uint32_t frameIndex, uint32_t objectIndex,
+		const std::vector<std::vector<uint32_t>>& visibleLists);
+	void updateFrameCount(uint32_t frameCount);
+	void reserveVisible(uint32_t objectCount);
+
+	VkBuffer getHandle() const;
+	VkDeviceSize getInstanceOffset(uint32_t frameIndex) const;
+	VkDeviceSize getIndirectCommandOffset(uint32_t frameIndex) const;
+	VkDeviceSize getVisibleInstanceOffset(uint32_t frameIndex, uint32_t objectIndex) const;
+	VkDeviceSize getVisibleCommandOffset(uint32_t frameIndex, uint32_t objectIndex) const;
+	bool hasVisibleObjects() const;
+	bool hasVisibleCapacity() const;
+	uint32_t getInstanceCount() const;
+	uint32_t getCapacity() const;
+	const InstanceBounds& getBounds() const;
+};
@@ -0,0 +1,14 @@
+#pragma once
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+
+#include "glm/mat4x4.hpp"
+#include "glm/vec4.hpp"
+
+
+struct InstanceData
+{
+	glm::mat4 model;
+	glm::vec4 color;
+};
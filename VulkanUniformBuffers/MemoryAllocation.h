@@ -0,0 +1,14 @@
+#pragma once
+
+#include <vulkan.h>
+
+struct MemoryBlock;
+
+struct MemoryAllocation
+{
+	VkDeviceMemory memory;
+	VkDeviceSize offset;
+	VkDeviceSize size;
+	void* mappedData;
+	MemoryBlock* block;
+};
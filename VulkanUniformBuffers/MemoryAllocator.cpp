@@ -0,0 +1,437 @@
+#include "MemoryAllocator.h"
+#include "PhysicalDevice.h"
+#include "Device.h"
+#include <algorithm>
+#include <stdexcept>
+
+
+MemoryAllocator::MemoryAllocator(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device)
+{
+	this->device = device;
+
+	VkPhysicalDeviceProperties properties = physicalDevice->getProperties();
+	memoryProperties = physicalDevice->getMemoryProperties();
+	nonCoherentAtomSize = properties.limits.nonCoherentAtomSize;
+	maxMemoryAllocationCount = properties.limits.maxMemoryAllocationCount;
+	deviceMemoryCount = 0;
+}
+
+MemoryAllocator::~MemoryAllocator()
+{
+	for (uint32_t i = 0; i < VK_MAX_MEMORY_TYPES; ++i)
+	{
+		for (std::unique_ptr<MemoryBlock>& block : linearBlocks[i])
+		{
+			destroyBlock(block.get());
+		}
+
+		for (std::unique_ptr<MemoryBlock>& block : optimalBlocks[i])
+		{
+			destroyBlock(block.get());
+		}
+	}
+}
+
+MemoryAllocation MemoryAllocator::allocateBufferMemory(VkBuffer buffer, VkMemoryPropertyFlags requiredFlags,
+	VkMemoryPropertyFlags preferredFlags)
+{
+	VkMemoryRequirements requirements;
+	vkGetBufferMemoryRequirements(device->getHandle(), buffer, &requirements);
+
+	MemoryAllocation allocation = allocate(requirements, requiredFlags, preferredFlags, true);
+
+	VkResult result = vkBindBufferMemory(device->getHandle(), buffer, allocation.memory, allocation.offset);
+	throwIfBindMemoryFailed(result);
+
+	return allocation;
+}
+
+MemoryAllocation MemoryAllocator::allocateImageMemory(VkImage image, VkMemoryPropertyFlags propertyFlags)
+{
+	VkMemoryRequirements requirements;
+	vkGetImageMemoryRequirements(device->getHandle(), image, &requirements);
+
+	MemoryAllocation allocation = allocate(requirements, propertyFlags, 0, false);
+
+	VkResult result = vkBindImageMemory(device->getHandle(), image, allocation.memory, allocation.offset);
+	throwIfBindMemoryFailed(result);
+
+	return allocation;
+}
+
+MemoryAllocation MemoryAllocator::allocate(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags requiredFlags,
+	VkMemoryPropertyFlags preferredFlags, bool linear)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	uint32_t memoryTypeIndex = findMemoryTypeIndex(requirements.memoryTypeBits, requiredFlags, preferredFlags);
+	VkDeviceSize blockSize = calculateBlockSize(memoryTypeIndex);
+	VkDeviceSize size = requirements.size;
+	VkDeviceSize alignment = requirements.alignment;
+
+	// Flushes of non-coherent memory work in nonCoherentAtomSize units, so keep every allocation on its own atoms.
+	if (isHostVisible(memoryTypeIndex) && !isHostCoherent(memoryTypeIndex))
+	{
+		alignment = std::max(alignment, nonCoherentAtomSize);
+		size = alignUp(size, nonCoherentAtomSize);
+	}
+
+	MemoryAllocation allocation = {};
+
+	if (size > blockSize / 2)
+	{
+		MemoryBlock* block = createBlock(memoryTypeIndex, size, linear, true);
+		tryAllocateFromBlock(block, size, alignment, &allocation);
+		return allocation;
+	}
+
+	for (std::unique_ptr<MemoryBlock>& block : *getBlocks(memoryTypeIndex, linear))
+	{
+		if (!block->dedicated && tryAllocateFromBlock(block.get(), size, alignment, &allocation))
+		{
+			return allocation;
+		}
+	}
+
+	MemoryBlock* block = createBlock(memoryTypeIndex, blockSize, linear, false);
+	tryAllocateFromBlock(block, size, alignment, &allocation);
+
+	return allocation;
+}
+
+void MemoryAllocator::flush(const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size)
+{
+	if (isHostCoherent(allocation.block->memoryTypeIndex))
+	{
+		return;
+	}
+
+	VkDeviceSize begin = allocation.offset + offset;
+	VkDeviceSize alignedBegin = begin / nonCoherentAtomSize * nonCoherentAtomSize;
+	VkDeviceSize alignedEnd = std::min(alignUp(begin + size, nonCoherentAtomSize), allocation.block->size);
+
+	VkMappedMemoryRange range = {};
+	range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+	range.memory = allocation.memory;
+	range.offset = alignedBegin;
+	range.size = alignedEnd - alignedBegin;
+
+	VkResult result = vkFlushMappedMemoryRanges(device->getHandle(), 1, &range);
+	throwIfFlushMemoryFailed(result);
+}
+
+void MemoryAllocator::free(const MemoryAllocation& allocation)
+{
+	if (allocation.block == nullptr)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	MemoryBlock* block = allocation.block;
+	block->usedSize -= allocation.size;
+	--block->allocationCount;
+	insertFreeRange(block, { allocation.offset, allocation.size });
+
+	releaseBlockIfEmpty(block);
+}
+
+uint32_t MemoryAllocator::findMemoryTypeIndex(uint32_t typeFilter, VkMemoryPropertyFlags requiredFlags,
+	VkMemoryPropertyFlags preferredFlags) const
+{
+	uint32_t memoryTypeIndex;
+
+	if (tryFindMemoryTypeIndex(typeFilter, requiredFlags | preferredFlags, &memoryTypeIndex) ||
+		tryFindMemoryTypeIndex(typeFilter, requiredFlags, &memoryTypeIndex))
+	{
+		return memoryTypeIndex;
+	}
+
+	throw std::runtime_error("Can't find memory type.");
+}
+
+bool MemoryAllocator::tryFindMemoryTypeIndex(uint32_t typeFilter, VkMemoryPropertyFlags propertyFlags,
+	uint32_t* outMemoryTypeIndex) const
+{
+	for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i)
+	{
+		if ((typeFilter & (1 << i)) &&
+			(memoryProperties.memoryTypes[i].propertyFlags & propertyFlags) == propertyFlags)
+		{
+			*outMemoryTypeIndex = i;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool MemoryAllocator::isHostVisible(uint32_t memoryTypeIndex) const
+{
+	return memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+}
+
+bool MemoryAllocator::isHostCoherent(uint32_t memoryTypeIndex) const
+{
+	return memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+}
+
+VkDeviceSize MemoryAllocator::calculateBlockSize(uint32_t memoryTypeIndex) const
+{
+	uint32_t heapIndex = memoryProperties.memoryTypes[memoryTypeIndex].heapIndex;
+	VkDeviceSize heapSize = memoryProperties.memoryHeaps[heapIndex].size;
+
+	if (heapSize <= SMALL_HEAP_SIZE)
+	{
+		return heapSize / 8;
+	}
+
+	return DEFAULT_BLOCK_SIZE;
+}
+
+std::vector<std::unique_ptr<MemoryBlock>>* MemoryAllocator::getBlocks(uint32_t memoryTypeIndex, bool linear)
+{
+	return linear ? &linearBlocks[memoryTypeIndex] : &optimalBlocks[memoryTypeIndex];
+}
+
+MemoryBlock* MemoryAllocator::createBlock(uint32_t memoryTypeIndex, VkDeviceSize size, bool linear, bool dedicated)
+{
+	throwIfTooManyAllocations();
+
+	VkMemoryAllocateInfo allocateInfo = {};
+	allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	allocateInfo.allocationSize = size;
+	allocateInfo.memoryTypeIndex = memoryTypeIndex;
+
+	std::unique_ptr<MemoryBlock> block = std::make_unique<MemoryBlock>();
+	VkResult result = vkAllocateMemory(device->getHandle(), &allocateInfo, nullptr, &block->vkDeviceMemory);
+	throwIfAllocateMemoryFailed(result);
+	++deviceMemoryCount;
+
+	block->size = size;
+	block->usedSize = 0;
+	block->allocationCount = 0;
+	block->memoryTypeIndex = memoryTypeIndex;
+	block->linear = linear;
+	block->dedicated = dedicated;
+	block->mappedData = nullptr;
+	block->freeRanges.push_back({ 0, size });
+
+	// A VkDeviceMemory can only be mapped once, so host visible blocks stay mapped for their whole
+	// lifetime and every sub-allocation gets a pointer into that mapping.
+	if (isHostVisible(memoryTypeIndex))
+	{
+		result = vkMapMemory(device->getHandle(), block->vkDeviceMemory, 0, VK_WHOLE_SIZE, 0, &block->mappedData);
+		throwIfMapMemoryFailed(result);
+	}
+
+	MemoryBlock* blockPtr = block.get();
+	getBlocks(memoryTypeIndex, linear)->push_back(std::move(block));
+
+	return blockPtr;
+}
+
+void MemoryAllocator::destroyBlock(MemoryBlock* block)
+{
+	if (block->mappedData != nullptr)
+	{
+		vkUnmapMemory(device->getHandle(), block->vkDeviceMemory);
+	}
+
+	vkFreeMemory(device->getHandle(), block->vkDeviceMemory, nullptr);
+	--deviceMemoryCount;
+}
+
+void MemoryAllocator::releaseBlockIfEmpty(MemoryBlock* block)
+{
+	if (block->allocationCount > 0)
+	{
+		return;
+	}
+
+	std::vector<std::unique_ptr<MemoryBlock>>* blocks = getBlocks(block->memoryTypeIndex, block->linear);
+
+	size_t sharedBlockCount = std::count_if(blocks->begin(), blocks->end(),
+		[](const std::unique_ptr<MemoryBlock>& candidate) { return !candidate->dedicated; });
+
+	// Keep the last shared block of a pool around so that a free/allocate pair does not hit the driver twice.
+	if (!block->dedicated && sharedBlockCount <= 1)
+	{
+		return;
+	}
+
+	destroyBlock(block);
+
+	blocks->erase(std::find_if(blocks->begin(), blocks->end(),
+		[block](const std::unique_ptr<MemoryBlock>& candidate) { return candidate.get() == block; }));
+}
+
+bool MemoryAllocator::tryAllocateFromBlock(MemoryBlock* block, VkDeviceSize size, VkDeviceSize alignment,
+	MemoryAllocation* outAllocation) const
+{
+	std::vector<MemoryRange>::iterator bestRange = block->freeRanges.end();
+
+	for (std::vector<MemoryRange>::iterator it = block->freeRanges.begin(); it != block->freeRanges.end(); ++it)
+	{
+		VkDeviceSize padding = alignUp(it->offset, alignment) - it->offset;
+
+		if (padding + size <= it->size && (bestRange == block->freeRanges.end() || it->size < bestRange->size))
+		{
+			bestRange = it;
+		}
+	}
+
+	if (bestRange == block->freeRanges.end())
+	{
+		return false;
+	}
+
+	MemoryRange range = *bestRange;
+	VkDeviceSize alignedOffset = alignUp(range.offset, alignment);
+	VkDeviceSize padding = alignedOffset - range.offset;
+	VkDeviceSize tail = range.size - padding - size;
+
+	std::vector<MemoryRange> remainders;
+
+	if (padding > 0)
+	{
+		remainders.push_back({ range.offset, padding });
+	}
+
+	if (tail > 0)
+	{
+		remainders.push_back({ alignedOffset + size, tail });
+	}
+
+	bestRange = block->freeRanges.erase(bestRange);
+	block->freeRanges.insert(bestRange, remainders.begin(), remainders.end());
+
+	block->usedSize += size;
+	++block->allocationCount;
+
+	outAllocation->memory = block->vkDeviceMemory;
+	outAllocation->offset = alignedOffset;
+	outAllocation->size = size;
+	outAllocation->mappedData = block->mappedData != nullptr ?
+		static_cast<char*>(block->mappedData) + alignedOffset : nullptr;
+	outAllocation->block = block;
+
+	return true;
+}
+
+void MemoryAllocator::insertFreeRange(MemoryBlock* block, MemoryRange range) const
+{
+	std::vector<MemoryRange>& ranges = block->freeRanges;
+
+	std::vector<MemoryRange>::iterator next = std::lower_bound(ranges.begin(), ranges.end(), range,
+		[](const MemoryRange& lhs, const MemoryRange& rhs) { return lhs.offset < rhs.offset; });
+
+	std::vector<MemoryRange>::iterator inserted = ranges.insert(next, range);
+
+	std::vector<MemoryRange>::iterator following = inserted + 1;
+	if (following != ranges.end() && inserted->offset + inserted->size == following->offset)
+	{
+		inserted->size += following->size;
+		inserted = ranges.erase(following) - 1;
+	}
+
+	if (inserted != ranges.begin())
+	{
+		std::vector<MemoryRange>::iterator previous = inserted - 1;
+		if (previous->offset + previous->size == inserted->offset)
+		{
+			previous->size += inserted->size;
+			ranges.erase(inserted);
+		}
+	}
+}
+
+VkDeviceSize MemoryAllocator::alignUp(VkDeviceSize value, VkDeviceSize alignment) const
+{
+	return (value + alignment - 1) / alignment * alignment;
+}
+
+MemoryAllocatorStats MemoryAllocator::getStats() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	MemoryAllocatorStats stats = {};
+
+	for (uint32_t i = 0; i < VK_MAX_MEMORY_TYPES; ++i)
+	{
+		for (const std::vector<std::unique_ptr<MemoryBlock>>* blocks : { &linearBlocks[i], &optimalBlocks[i] })
+		{
+			for (const std::unique_ptr<MemoryBlock>& block : *blocks)
+			{
+				MemoryBlockStats blockStats = {};
+				blockStats.memoryTypeIndex = block->memoryTypeIndex;
+				blockStats.dedicated = block->dedicated;
+				blockStats.size = block->size;
+				blockStats.usedSize = block->usedSize;
+				blockStats.allocationCount = block->allocationCount;
+				blockStats.freeRangeCount = static_cast<uint32_t>(block->freeRanges.size());
+
+				for (const MemoryRange& range : block->freeRanges)
+				{
+					blockStats.largestFreeRange = std::max(blockStats.largestFreeRange, range.size);
+				}
+
+				++stats.blockCount;
+				stats.allocationCount += blockStats.allocationCount;
+				stats.blockBytes += blockStats.size;
+				stats.usedBytes += blockStats.usedSize;
+				stats.freeBytes += blockStats.size - blockStats.usedSize;
+				stats.largestFreeRange = std::max(stats.largestFreeRange, blockStats.largestFreeRange);
+				stats.blocks.push_back(blockStats);
+			}
+		}
+	}
+
+	if (stats.freeBytes > 0)
+	{
+		stats.fragmentation = 1.0f - static_cast<float>(stats.largestFreeRange) / static_cast<float>(stats.freeBytes);
+	}
+
+	return stats;
+}
+
+void MemoryAllocator::throwIfTooManyAllocations() const
+{
+	if (deviceMemoryCount >= maxMemoryAllocationCount)
+	{
+		throw std::runtime_error("Exceeded maxMemoryAllocationCount.");
+	}
+}
+
+void MemoryAllocator::throwIfAllocateMemoryFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to allocate device memory block.");
+	}
+}
+
+void MemoryAllocator::throwIfMapMemoryFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to map device memory block.");
+	}
+}
+
+void MemoryAllocator::throwIfFlushMemoryFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to flush mapped device memory.");
+	}
+}
+
+void MemoryAllocator::throwIfBindMemoryFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to bind device memory.");
+	}
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <vulkan.h>
+#include <memory>
+#include <vector>
+#include <mutex>
+#include "MemoryAllocation.h"
+#include "MemoryAllocatorStats.h"
+
+
+class PhysicalDevice;
+class Device;
+
+
+struct MemoryRange
+{
+	VkDeviceSize offset;
+	VkDeviceSize size;
+};
+
+struct MemoryBlock
+{
+	VkDeviceMemory vkDeviceMemory;
+	VkDeviceSize size;
+	VkDeviceSize usedSize;
+	uint32_t allocationCount;
+	uint32_t memoryTypeIndex;
+	bool linear;
+	bool dedicated;
+	void* mappedData;
+	std::vector<MemoryRange> freeRanges;
+};
+
+
+class MemoryAllocator
+{
+private:
+	const VkDeviceSize DEFAULT_BLOCK_SIZE = 64ull * 1024 * 1024;
+	const VkDeviceSize SMALL_HEAP_SIZE = 1024ull * 1024 * 1024;
+
+	std::shared_ptr<Device> device;
+	VkPhysicalDeviceMemoryProperties memoryProperties;
+	VkDeviceSize nonCoherentAtomSize;
+	uint32_t maxMemoryAllocationCount;
+	uint32_t deviceMemoryCount;
+	mutable std::mutex mutex;
+
+	// Buffers and optimal-tiling images live in separate pools, so neighbouring sub-allocations never
+	// need bufferImageGranularity padding between them.
+	std::vector<std::unique_ptr<MemoryBlock>> linearBlocks[VK_MAX_MEMORY_TYPES];
+	std::vector<std::unique_ptr<MemoryBlock>> optimalBlocks[VK_MAX_MEMORY_TYPES];
+
+	MemoryAllocation allocate(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags requiredFlags,
+		VkMemoryPropertyFlags preferredFlags, bool linear);
+
+	uint32_t findMemoryTypeIndex(uint32_t typeFilter, VkMemoryPropertyFlags requiredFlags,
+		VkMemoryPropertyFlags preferredFlags) const;
+
+	bool tryFindMemoryTypeIndex(uint32_t typeFilter, VkMemoryPropertyFlags propertyFlags,
+		uint32_t* outMemoryTypeIndex) const;
+
+	bool isHostVisible(uint32_t memoryTypeIndex) const;
+	bool isHostCoherent(uint32_t memoryTypeIndex) const;
+	VkDeviceSize calculateBlockSize(uint32_t memoryTypeIndex) const;
+	std::vector<std::unique_ptr<MemoryBlock>>* getBlocks(uint32_t memoryTypeIndex, bool linear);
+	MemoryBlock* createBlock(uint32_t memoryTypeIndex, VkDeviceSize size, bool linear, bool dedicated);
+	void destroyBlock(MemoryBlock* block);
+	void releaseBlockIfEmpty(MemoryBlock* block);
+
+	bool tryAllocateFromBlock(MemoryBlock* block, VkDeviceSize size, VkDeviceSize alignment,
+		MemoryAllocation* outAllocation) const;
+
+	void insertFreeRange(MemoryBlock* block, MemoryRange range) const;
+	VkDeviceSize alignUp(VkDeviceSize value, VkDeviceSize alignment) const;
+	void throwIfTooManyAllocations() const;
+	void throwIfAllocateMemoryFailed(VkResult result) const;
+	void throwIfMapMemoryFailed(VkResult result) const;
+	void throwIfFlushMemoryFailed(VkResult result) const;
+	void throwIfBindMemoryFailed(VkResult result) const;
+
+public:
+	MemoryAllocator(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device);
+	~MemoryAllocator();
+
+	MemoryAllocation allocateBufferMemory(VkBuffer buffer, VkMemoryPropertyFlags requiredFlags,
+		VkMemoryPropertyFlags preferredFlags);
+
+	MemoryAllocation allocateImageMemory(VkImage image, VkMemoryPropertyFlags propertyFlags);
+	void flush(const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size);
+	void free(const MemoryAllocation& allocation);
+
+	MemoryAllocatorStats getStats() const;
+};
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+#include <vulkan.h>
+
+struct MemoryBlockStats
+{
+	uint32_t memoryTypeIndex;
+	bool dedicated;
+	VkDeviceSize size;
+	VkDeviceSize usedSize;
+	uint32_t allocationCount;
+	uint32_t freeRangeCount;
+	VkDeviceSize largestFreeRange;
+};
+
+struct MemoryAllocatorStats
+{
+	uint32_t blockCount;
+	uint32_t allocationCount;
+	VkDeviceSize blockBytes;
+	VkDeviceSize usedBytes;
+	VkDeviceSize freeBytes;
+	VkDeviceSize largestFreeRange;
+
+	// 0 when all free space is one contiguous range, approaching 1 as it splits into small holes.
+	float fragmentation;
+	std::vector<MemoryBlockStats> blocks;
+};
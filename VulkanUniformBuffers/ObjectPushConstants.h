@@ -0,0 +1,12 @@
+#pragma once
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+
+#include "glm/mat4x4.hpp"
+
+
+struct ObjectPushConstants
+{
+	glm::mat4 model;
+};
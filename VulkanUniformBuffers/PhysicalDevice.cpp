@@ -2,6 +2,7 @@
 #include "VulkanInstance.h"
 #include "VulkanSurface.h"
 #include <set>
+#include <cstring>
 
 
 PhysicalDevice::PhysicalDevice(std::shared_ptr<VulkanInstance> vulkanInstance, std::shared_ptr<VulkanSurface> vulkanSurface)
@@ -13,6 +14,20 @@ PhysicalDevice::PhysicalDevice(std::shared_ptr<VulkanInstance> vulkanInstance, s
 	std::vector<VkPhysicalDevice> availableDevices = listAvailableDevices();
 	findSuitableDevice(&availableDevices);
 	throwIfNotFoundDiscreteGpu(vkPhysicalDevice);
+	enableTimelineSemaphoreIfSupported();
+	enableDrawIndirectCountIfSupported();
+}
+
+PhysicalDevice::PhysicalDevice(std::shared_ptr<VulkanInstance> vulkanInstance)
+{
+	this->vulkanInstance = vulkanInstance;
+
+	std::vector<VkPhysicalDevice> availableDevices = listAvailableDevices();
+	findHeadlessDevice(&availableDevices);
+	throwIfNotFoundDevice(vkPhysicalDevice);
+	queueFamilyIndices = findHeadlessQueueFamilyIndices(vkPhysicalDevice);
+	enableTimelineSemaphoreIfSupported();
+	enableDrawIndirectCountIfSupported();
 }
 
 void PhysicalDevice::buildDeviceExtensions()
@@ -20,6 +35,145 @@ void PhysicalDevice::buildDeviceExtensions()
 	deviceExtensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
 }
 
+void PhysicalDevice::findHeadlessDevice(std::vector<VkPhysicalDevice>* availableDevices)
+{
+	vkPhysicalDevice = VK_NULL_HANDLE;
+	int bestRank = -1;
+
+	for (VkPhysicalDevice availableDevice : *availableDevices)
+	{
+		int rank = rankHeadlessDevice(availableDevice);
+
+		if (hasGraphicsQueue(availableDevice) && rank > bestRank)
+		{
+			vkPhysicalDevice = availableDevice;
+			bestRank = rank;
+		}
+	}
+}
+
+int PhysicalDevice::rankHeadlessDevice(VkPhysicalDevice physicalDevice) const
+{
+	VkPhysicalDeviceProperties properties;
+	vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+
+	switch (properties.deviceType)
+	{
+	case VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU:
+		return 4;
+	case VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU:
+		return 3;
+	case VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU:
+		return 2;
+	case VK_PHYSICAL_DEVICE_TYPE_CPU:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+bool PhysicalDevice::hasGraphicsQueue(VkPhysicalDevice physicalDevice) const
+{
+	for (VkQueueFamilyProperties queueFamily : listQueueFamilyProperties(physicalDevice))
+	{
+		if (isGraphicsQueue(queueFamily.queueFlags))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+QueueFamilyIndices PhysicalDevice::findHeadlessQueueFamilyIndices(VkPhysicalDevice physicalDevice)
+{
+	QueueFamilyIndices queueFamilyIndices;
+	std::vector<VkQueueFamilyProperties> queueFamilies = listQueueFamilyProperties(physicalDevice);
+
+	for (unsigned int index = 0; index < queueFamilies.size(); ++index)
+	{
+		if (isGraphicsQueue(queueFamilies[index].queueFlags))
+		{
+			assignGraphicsIndexIfNotSet(&queueFamilyIndices, index);
+		}
+
+		assignTransferIndexIfTransferOnly(queueFamilies[index], &queueFamilyIndices, index);
+	}
+
+	queueFamilyIndices.presentation = queueFamilyIndices.graphics;
+
+	return queueFamilyIndices;
+}
+
+void PhysicalDevice::throwIfNotFoundDevice(VkPhysicalDevice vkPhysicalDevice) const
+{
+	if (vkPhysicalDevice == VK_NULL_HANDLE)
+	{
+		throw std::runtime_error("None physical device with a graphics queue is available.");
+	}
+}
+
+void PhysicalDevice::enableTimelineSemaphoreIfSupported()
+{
+	timelineSemaphoreSupported = checkTimelineSemaphoreSupport(vkPhysicalDevice);
+
+	if (timelineSemaphoreSupported)
+	{
+		deviceExtensions.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+	}
+}
+
+bool PhysicalDevice::checkTimelineSemaphoreSupport(VkPhysicalDevice physicalDevice) const
+{
+	VkPhysicalDeviceProperties properties;
+	vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+
+	if (properties.apiVersion < VK_API_VERSION_1_1 ||
+		!isDeviceExtensionAvailable(physicalDevice, VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME))
+	{
+		return false;
+	}
+
+	VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timelineFeatures = {};
+	timelineFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+
+	VkPhysicalDeviceFeatures2 features = {};
+	features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+	features.pNext = &timelineFeatures;
+	vkGetPhysicalDeviceFeatures2(physicalDevice, &features);
+
+	return timelineFeatures.timelineSemaphore == VK_TRUE;
+}
+
+void PhysicalDevice::enableDrawIndirectCountIfSupported()
+{
+	drawIndirectCountSupported = isDeviceExtensionAvailable(vkPhysicalDevice, VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+
+	if (drawIndirectCountSupported)
+	{
+		deviceExtensions.push_back(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+	}
+}
+
+bool PhysicalDevice::isDeviceExtensionAvailable(VkPhysicalDevice physicalDevice, const char* extensionName) const
+{
+	uint32_t availableExtensionCount;
+	vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &availableExtensionCount, nullptr);
+
+	std::vector<VkExtensionProperties> availableExtensions(availableExtensionCount);
+	vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &availableExtensionCount, availableExtensions.data());
+
+	for (const VkExtensionProperties& available : availableExtensions)
+	{
+		if (strcmp(available.extensionName, extensionName) == 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 std::vector<VkPhysicalDevice> PhysicalDevice::listAvailableDevices()
 {
 	unsigned int deviceCount = 0;
@@ -145,16 +299,16 @@ QueueFamilyIndices PhysicalDevice::findQueueFamilyIndices(VkPhysicalDevice physi
 	for (VkQueueFamilyProperties queueFamily : queueFamilies)
 	{
 		assignGraphicsOrPresentationIndex(queueFamily, physicalDevice, &queueFamilyIndices, index);
-
-		if (areQueueFamiliesSet(queueFamilyIndices))
-		{
-			return queueFamilyIndices;
-		}
-
+		assignTransferIndexIfTransferOnly(queueFamily, &queueFamilyIndices, index);
 		++index;
 	}
 
-	throwQueueFamilyPropertiesNotFound();
+	if (!areQueueFamiliesSet(queueFamilyIndices))
+	{
+		throwQueueFamilyPropertiesNotFound();
+	}
+
+	return queueFamilyIndices;
 }
 
 
@@ -175,6 +329,20 @@ bool PhysicalDevice::isGraphicsQueue(VkQueueFlags queueFlags) const
 	return queueFlags & VK_QUEUE_GRAPHICS_BIT;
 }
 
+bool PhysicalDevice::isTransferOnlyQueue(VkQueueFlags queueFlags) const
+{
+	return (queueFlags & VK_QUEUE_TRANSFER_BIT) && !(queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT));
+}
+
+void PhysicalDevice::assignTransferIndexIfTransferOnly(VkQueueFamilyProperties queueFamily,
+	QueueFamilyIndices* queueFamilyIndices, unsigned int index)
+{
+	if (isTransferOnlyQueue(queueFamily.queueFlags) && !queueFamilyIndices->transfer.has_value())
+	{
+		queueFamilyIndices->transfer = index;
+	}
+}
+
 void PhysicalDevice::assignGraphicsIndexIfNotSet(QueueFamilyIndices* queueFamilyIndices, unsigned int index)
 {
 	if (isGraphicsNotSet(*queueFamilyIndices))
@@ -240,6 +408,11 @@ SwapChainSupportDetails PhysicalDevice::getSwapChainSupportDetails() const
 	return swapChainSupportDetails;
 }
 
+void PhysicalDevice::updateSwapChainSupportDetails()
+{
+	swapChainSupportDetails = querySwapChainSupport(vkPhysicalDevice);
+}
+
 QueueFamilyIndices PhysicalDevice::getQueueFamilyIndices() const
 {
 	return queueFamilyIndices;
@@ -283,4 +456,35 @@ uint32_t PhysicalDevice::findMemoryType(uint32_t typeFilter, VkMemoryPropertyFla
 	}
 
 	throw std::runtime_error("Can't find memory type.");
+}
+
+VkPhysicalDeviceProperties PhysicalDevice::getProperties() const
+{
+	VkPhysicalDeviceProperties properties;
+	vkGetPhysicalDeviceProperties(vkPhysicalDevice, &properties);
+
+	return properties;
+}
+
+VkPhysicalDeviceMemoryProperties PhysicalDevice::getMemoryProperties() const
+{
+	VkPhysicalDeviceMemoryProperties memoryProperties;
+	vkGetPhysicalDeviceMemoryProperties(vkPhysicalDevice, &memoryProperties);
+
+	return memoryProperties;
+}
+
+bool PhysicalDevice::isTimelineSemaphoreSupported() const
+{
+	return timelineSemaphoreSupported;
+}
+
+bool PhysicalDevice::isDrawIndirectCountSupported() const
+{
+	return drawIndirectCountSupported;
+}
+
+VkQueueFamilyProperties PhysicalDevice::getGraphicsQueueFamilyProperties() const
+{
+	return listQueueFamilyProperties(vkPhysicalDevice)[queueFamilyIndices.graphics.value()];
 }
\ No newline at end of file
@@ -21,8 +21,19 @@ private:
 	std::vector<const char*> deviceExtensions;
 	SwapChainSupportDetails swapChainSupportDetails;
 	QueueFamilyIndices queueFamilyIndices;
+	bool timelineSemaphoreSupported;
+	bool drawIndirectCountSupported;
 
 	void buildDeviceExtensions();
+	void findHeadlessDevice(std::vector<VkPhysicalDevice>* availableDevices);
+	int rankHeadlessDevice(VkPhysicalDevice physicalDevice) const;
+	bool hasGraphicsQueue(VkPhysicalDevice physicalDevice) const;
+	QueueFamilyIndices findHeadlessQueueFamilyIndices(VkPhysicalDevice physicalDevice);
+	void throwIfNotFoundDevice(VkPhysicalDevice vkPhysicalDevice) const;
+	void enableTimelineSemaphoreIfSupported();
+	bool checkTimelineSemaphoreSupport(VkPhysicalDevice physicalDevice) const;
+	void enableDrawIndirectCountIfSupported();
+	bool isDeviceExtensionAvailable(VkPhysicalDevice physicalDevice, const char* extensionName) const;
 	std::vector<VkPhysicalDevice> listAvailableDevices();
 	void throwIfNotFoundDevices(unsigned int deviceCount) const;
 	void findSuitableDevice(std::vector<VkPhysicalDevice>* availableDevices);
@@ -39,6 +50,11 @@ private:
 		QueueFamilyIndices* queueFamilyIndices, unsigned int index);
 
 	bool isGraphicsQueue(VkQueueFlags queueFlags) const;
+	bool isTransferOnlyQueue(VkQueueFlags queueFlags) const;
+
+	void assignTransferIndexIfTransferOnly(VkQueueFamilyProperties queueFamily, QueueFamilyIndices* queueFamilyIndices,
+		unsigned int index);
+
 	void assignGraphicsIndexIfNotSet(QueueFamilyIndices* queueFamilyIndices, unsigned int index);
 	bool isGraphicsNotSet(QueueFamilyIndices queueFamilyIndices) const;
 	bool isPresentationNotSet(QueueFamilyIndices queueFamilyIndices) const;
@@ -53,8 +69,10 @@ private:
 
 public:
 	PhysicalDevice(std::shared_ptr<VulkanInstance> vulkanInstance, std::shared_ptr<VulkanSurface> vulkanSurface);
+	PhysicalDevice(std::shared_ptr<VulkanInstance> vulkanInstance);
 	std::vector<const char*>* getDeviceExtensions();
 	SwapChainSupportDetails getSwapChainSupportDetails() const;
+	void updateSwapChainSupportDetails();
 	QueueFamilyIndices getQueueFamilyIndices() const;
 	VkPhysicalDevice getHandle() const;
 
@@ -62,4 +80,9 @@ public:
 		VkFormatFeatureFlags features) const;
 
 	uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags propertyFlags) const;
+	VkPhysicalDeviceProperties getProperties() const;
+	VkPhysicalDeviceMemoryProperties getMemoryProperties() const;
+	bool isTimelineSemaphoreSupported() const;
+	bool isDrawIndirectCountSupported() const;
+	VkQueueFamilyProperties getGraphicsQueueFamilyProperties() const;
 };
\ No newline at end of file
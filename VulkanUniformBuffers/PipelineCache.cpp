@@ -0,0 +1,161 @@
+#include "PipelineCache.h"
+#include "PhysicalDevice.h"
+#include "Device.h"
+#include <fstream>
+#include <filesystem>
+#include <cstring>
+#include <stdexcept>
+
+
+PipelineCache::PipelineCache(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
+	const std::string& fileName)
+{
+	this->device = device;
+	this->fileName = fileName;
+	properties = physicalDevice->getProperties();
+
+	std::vector<char> cacheData = loadCacheData();
+	loadedFromDisk = !cacheData.empty();
+
+	VkPipelineCacheCreateInfo createInfo = {};
+	createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+	createInfo.initialDataSize = cacheData.size();
+	createInfo.pInitialData = cacheData.empty() ? nullptr : cacheData.data();
+
+	VkResult result = vkCreatePipelineCache(device->getHandle(), &createInfo, nullptr, &vkPipelineCache);
+	throwIfCreationFailed(result);
+}
+
+PipelineCache::~PipelineCache()
+{
+	vkDestroyPipelineCache(device->getHandle(), vkPipelineCache, nullptr);
+}
+
+std::vector<char> PipelineCache::loadCacheData() const
+{
+	std::ifstream istr(fileName, std::ios::binary);
+
+	if (!istr.is_open())
+	{
+		return {};
+	}
+
+	PipelineCacheFileHeader header = {};
+	istr.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+	if (!istr || !isFileHeaderValid(header))
+	{
+		return {};
+	}
+
+	std::vector<char> cacheData(header.dataSize);
+	istr.read(cacheData.data(), cacheData.size());
+
+	if (!istr || !isCacheHeaderValid(cacheData))
+	{
+		return {};
+	}
+
+	return cacheData;
+}
+
+bool PipelineCache::isFileHeaderValid(const PipelineCacheFileHeader& header) const
+{
+	return header.magic == FILE_MAGIC &&
+		header.vendorID == properties.vendorID &&
+		header.deviceID == properties.deviceID &&
+		header.driverVersion == properties.driverVersion &&
+		memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+bool PipelineCache::isCacheHeaderValid(const std::vector<char>& cacheData) const
+{
+	const size_t headerSize = 4 * sizeof(uint32_t) + VK_UUID_SIZE;
+
+	if (cacheData.size() < headerSize)
+	{
+		return false;
+	}
+
+	uint32_t headerFields[4];
+	memcpy(headerFields, cacheData.data(), sizeof(headerFields));
+
+	return headerFields[0] >= headerSize &&
+		headerFields[1] == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+		headerFields[2] == properties.vendorID &&
+		headerFields[3] == properties.deviceID &&
+		memcmp(cacheData.data() + sizeof(headerFields), properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+void PipelineCache::save() const
+{
+	size_t dataSize = 0;
+	VkResult result = vkGetPipelineCacheData(device->getHandle(), vkPipelineCache, &dataSize, nullptr);
+	throwIfGetDataFailed(result);
+
+	std::vector<char> cacheData(dataSize);
+	result = vkGetPipelineCacheData(device->getHandle(), vkPipelineCache, &dataSize, cacheData.data());
+	throwIfGetDataFailed(result);
+
+	PipelineCacheFileHeader header = buildFileHeader(dataSize);
+	std::string tempFileName = fileName + ".tmp";
+
+	{
+		std::ofstream ostr(tempFileName, std::ios::binary | std::ios::trunc);
+		ostr.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		ostr.write(cacheData.data(), dataSize);
+		ostr.close();
+		throwIfWriteFailed(ostr.fail());
+	}
+
+	std::error_code errorCode;
+	std::filesystem::rename(tempFileName, fileName, errorCode);
+	throwIfWriteFailed(static_cast<bool>(errorCode));
+}
+
+PipelineCacheFileHeader PipelineCache::buildFileHeader(size_t dataSize) const
+{
+	PipelineCacheFileHeader header = {};
+	header.magic = FILE_MAGIC;
+	header.dataSize = static_cast<uint32_t>(dataSize);
+	header.vendorID = properties.vendorID;
+	header.deviceID = properties.deviceID;
+	header.driverVersion = properties.driverVersion;
+	memcpy(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+	return header;
+}
+
+bool PipelineCache::isLoadedFromDisk() const
+{
+	return loadedFromDisk;
+}
+
+VkPipelineCache PipelineCache::getHandle() const
+{
+	return vkPipelineCache;
+}
+
+void PipelineCache::throwIfCreationFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create pipeline cache.");
+	}
+}
+
+void PipelineCache::throwIfGetDataFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to get pipeline cache data.");
+	}
+}
+
+void PipelineCache::throwIfWriteFailed(bool failed) const
+{
+	if (failed)
+	{
+		throw std::runtime_error("Failed to write pipeline cache file.");
+	}
+}
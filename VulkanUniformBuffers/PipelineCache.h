@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vulkan.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "PipelineCacheFileHeader.h"
+
+
+class PhysicalDevice;
+class Device;
+
+
+class PipelineCache
+{
+private:
+	const uint32_t FILE_MAGIC = 0x43505655;
+
+	std::shared_ptr<Device> device;
+	VkPhysicalDeviceProperties properties;
+	std::string fileName;
+	VkPipelineCache vkPipelineCache;
+	bool loadedFromDisk;
+
+	std::vector<char> loadCacheData() const;
+	bool isFileHeaderValid(const PipelineCacheFileHeader& header) const;
+	bool isCacheHeaderValid(const std::vector<char>& cacheData) const;
+	PipelineCacheFileHeader buildFileHeader(size_t dataSize) const;
+	void throwIfCreationFailed(VkResult result) const;
+	void throwIfGetDataFailed(VkResult result) const;
+	void throwIfWriteFailed(bool failed) const;
+
+public:
+	PipelineCache(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
+		const std::string& fileName);
+
+	~PipelineCache();
+
+	void save() const;
+	bool isLoadedFromDisk() const;
+	VkPipelineCache getHandle() const;
+};
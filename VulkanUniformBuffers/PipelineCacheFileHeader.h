@@ -0,0 +1,14 @@
+#pragma once
+
+#include <vulkan.h>
+#include <cstdint>
+
+struct PipelineCacheFileHeader
+{
+	uint32_t magic;
+	uint32_t dataSize;
+	uint32_t vendorID;
+	uint32_t deviceID;
+	uint32_t driverVersion;
+	uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+};
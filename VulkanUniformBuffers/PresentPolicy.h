@@ -0,0 +1,9 @@
+#pragma once
+
+enum class PresentPolicy
+{
+	Vsync,
+	Mailbox,
+	Immediate,
+	FifoRelaxed
+};
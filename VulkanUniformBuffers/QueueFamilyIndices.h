@@ -6,4 +6,5 @@ struct QueueFamilyIndices
 {
 	std::optional<uint32_t> graphics;
 	std::optional<uint32_t> presentation;
+	std::optional<uint32_t> transfer;
 };
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include <iostream>
 #include "SdlWindow.h"
+#include "StatsPrinter.h"
 
 
 SdlWindow::SdlWindow(std::shared_ptr<Engine> engine)
@@ -52,10 +53,75 @@ void SdlWindow::runMainLoop()
 	while (running)
 	{
 		dispatchSdlEventIfExist(&sdlEvent, &running);
+		waitWhileMinimized(&sdlEvent, &running);
+
+		if (!running)
+		{
+			break;
+		}
+
+		engine->update();
+		engine->render();
+	}
+
+	if (engine->isPerFrameRecordingActive())
+	{
+		printRecordingStats(engine->getRecordingStats());
+	}
+}
+
+void SdlWindow::runFramesInFlightComparison(int framesPerSetting)
+{
+	int initialFramesInFlight = engine->getFramesInFlight();
+
+	for (int framesInFlight = 1; framesInFlight <= 3; ++framesInFlight)
+	{
+		engine->setFramesInFlight(framesInFlight);
+
+		if (!runFrames(WARM_UP_FRAME_COUNT))
+		{
+			break;
+		}
+
+		engine->resetFrameStats();
+
+		if (!runFrames(framesPerSetting))
+		{
+			break;
+		}
+
+		printFrameStats("frames in flight: " + std::to_string(framesInFlight), engine->getFrameStats());
+		printGpuStats(engine->getGpuStats());
+
+		if (engine->isPerFrameRecordingActive())
+		{
+			printRecordingStats(engine->getRecordingStats());
+		}
+	}
+
+	engine->setFramesInFlight(initialFramesInFlight);
+}
+
+bool SdlWindow::runFrames(int frameCount)
+{
+	SDL_Event sdlEvent;
+	bool running = true;
+
+	for (int i = 0; i < frameCount && running; ++i)
+	{
+		dispatchSdlEventIfExist(&sdlEvent, &running);
+		waitWhileMinimized(&sdlEvent, &running);
+
+		if (!running)
+		{
+			break;
+		}
 
 		engine->update();
 		engine->render();
 	}
+
+	return running;
 }
 
 void SdlWindow::dispatchSdlEventIfExist(SDL_Event* sdlEvent, bool* outRunning)
@@ -71,12 +137,35 @@ void SdlWindow::dispatchSdlEvent(SDL_Event* sdlEvent, bool* outRunning)
 	switch (sdlEvent->type)
 	{
 	case SDL_WINDOWEVENT:
-		if (sdlEvent->window.event == SDL_WINDOWEVENT_CLOSE)
-		{
-			*outRunning = false;
-		}
+		dispatchWindowEvent(sdlEvent, outRunning);
 		break;
 	default:
 		engine->readInput(*sdlEvent);
 	}
+}
+
+void SdlWindow::dispatchWindowEvent(SDL_Event* sdlEvent, bool* outRunning)
+{
+	switch (sdlEvent->window.event)
+	{
+	case SDL_WINDOWEVENT_CLOSE:
+		*outRunning = false;
+		break;
+	case SDL_WINDOWEVENT_SIZE_CHANGED:
+		engine->notifyWindowResized();
+		break;
+	}
+}
+
+bool SdlWindow::isMinimized() const
+{
+	return SDL_GetWindowFlags(sdlWindow) & SDL_WINDOW_MINIMIZED;
+}
+
+void SdlWindow::waitWhileMinimized(SDL_Event* sdlEvent, bool* outRunning)
+{
+	while (*outRunning && isMinimized() && SDL_WaitEvent(sdlEvent))
+	{
+		dispatchSdlEvent(sdlEvent, outRunning);
+	}
 }
\ No newline at end of file
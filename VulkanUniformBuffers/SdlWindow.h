@@ -11,9 +11,10 @@ private:
 	const int WINDOW_X_POSITION = SDL_WINDOWPOS_UNDEFINED;
 	const int WINDOW_Y_POSITION = SDL_WINDOWPOS_UNDEFINED;
 	const char* WINDOW_TITLE = "Vulkan Uniform Buffers";
-	const Uint32 WINDOW_FLAGS = SDL_WINDOW_VULKAN;
+	const Uint32 WINDOW_FLAGS = SDL_WINDOW_VULKAN | SDL_WINDOW_RESIZABLE;
 	const int WINDOW_HEIGHT = 600;
 	const int WINDOW_WIDTH = 800;
+	const int WARM_UP_FRAME_COUNT = 60;
 
 	std::shared_ptr<Engine> engine;
 	SDL_Window* sdlWindow;
@@ -23,9 +24,14 @@ private:
 	bool isWindowNotCreated(SDL_Window* window);
 	void dispatchSdlEventIfExist(SDL_Event* sdlEvent, bool* outRunning);
 	void dispatchSdlEvent(SDL_Event* sdlEvent, bool* outRunning);
+	void dispatchWindowEvent(SDL_Event* sdlEvent, bool* outRunning);
+	bool isMinimized() const;
+	void waitWhileMinimized(SDL_Event* sdlEvent, bool* outRunning);
+	bool runFrames(int frameCount);
 
 public:
 	SdlWindow(std::shared_ptr<Engine> engine);
 	~SdlWindow();
 	void runMainLoop();
+	void runFramesInFlightComparison(int framesPerSetting);
 };
\ No newline at end of file
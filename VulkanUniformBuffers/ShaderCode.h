@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+struct ShaderCode
+{
+	const uint32_t* code;
+	size_t size;
+};
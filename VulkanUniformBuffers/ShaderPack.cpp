@@ -0,0 +1,173 @@
+#include "ShaderPack.h"
+#include <cstring>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+ShaderPack::ShaderPack(const std::string& path)
+{
+	mappedView = nullptr;
+	mapFile(path);
+
+	data = static_cast<const unsigned char*>(mappedView);
+
+	// The destructor does not run when the constructor throws, so the mapping is released here.
+	try
+	{
+		validate();
+	}
+	catch (...)
+	{
+		unmapFile();
+		throw;
+	}
+}
+
+ShaderPack::ShaderPack(const void* data, size_t dataSize)
+{
+	mappedView = nullptr;
+	this->data = static_cast<const unsigned char*>(data);
+	this->dataSize = dataSize;
+
+	validate();
+}
+
+ShaderPack::~ShaderPack()
+{
+	unmapFile();
+}
+
+#ifdef _WIN32
+void ShaderPack::mapFile(const std::string& path)
+{
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL, nullptr);
+	throwIfMapFailed(file == INVALID_HANDLE_VALUE);
+
+	LARGE_INTEGER fileSize;
+	GetFileSizeEx(file, &fileSize);
+	dataSize = static_cast<size_t>(fileSize.QuadPart);
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	throwIfMapFailed(mapping == nullptr);
+
+	mappedView = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	throwIfMapFailed(mappedView == nullptr);
+}
+
+void ShaderPack::unmapFile()
+{
+	if (mappedView != nullptr)
+	{
+		UnmapViewOfFile(mappedView);
+	}
+}
+#else
+void ShaderPack::mapFile(const std::string& path)
+{
+	int file = open(path.c_str(), O_RDONLY);
+	throwIfMapFailed(file < 0);
+
+	struct stat fileStat;
+	fstat(file, &fileStat);
+	dataSize = static_cast<size_t>(fileStat.st_size);
+
+	mappedView = mmap(nullptr, dataSize, PROT_READ, MAP_PRIVATE, file, 0);
+	close(file);
+
+	if (mappedView == MAP_FAILED)
+	{
+		mappedView = nullptr;
+	}
+
+	throwIfMapFailed(mappedView == nullptr);
+}
+
+void ShaderPack::unmapFile()
+{
+	if (mappedView != nullptr)
+	{
+		munmap(mappedView, dataSize);
+	}
+}
+#endif
+
+ShaderCode ShaderPack::getShaderCode(const char* name) const
+{
+	const ShaderPackEntry* entries = getEntries();
+
+	for (uint32_t i = 0; i < getHeader()->entryCount; ++i)
+	{
+		if (strncmp(entries[i].name, name, sizeof(entries[i].name)) == 0)
+		{
+			ShaderCode shaderCode = {};
+			shaderCode.code = reinterpret_cast<const uint32_t*>(data + entries[i].offset);
+			shaderCode.size = entries[i].size;
+
+			return shaderCode;
+		}
+	}
+
+	throwShaderNotFound(name);
+	return {};
+}
+
+const ShaderPackHeader* ShaderPack::getHeader() const
+{
+	return reinterpret_cast<const ShaderPackHeader*>(data);
+}
+
+const ShaderPackEntry* ShaderPack::getEntries() const
+{
+	return reinterpret_cast<const ShaderPackEntry*>(data + sizeof(ShaderPackHeader));
+}
+
+void ShaderPack::validate() const
+{
+	throwIfInvalid(dataSize < sizeof(ShaderPackHeader));
+
+	const ShaderPackHeader* header = getHeader();
+	throwIfInvalid(header->magic != PACK_MAGIC || header->version != PACK_VERSION);
+
+	size_t indexEnd = sizeof(ShaderPackHeader) + header->entryCount * sizeof(ShaderPackEntry);
+	throwIfInvalid(indexEnd > dataSize);
+
+	const ShaderPackEntry* entries = getEntries();
+
+	for (uint32_t i = 0; i < header->entryCount; ++i)
+	{
+		throwIfInvalid(entries[i].offset % sizeof(uint32_t) != 0 || entries[i].size % sizeof(uint32_t) != 0);
+		throwIfInvalid(entries[i].offset < indexEnd || entries[i].offset + entries[i].size > dataSize);
+	}
+}
+
+void ShaderPack::throwIfMapFailed(bool failed) const
+{
+	if (failed)
+	{
+		throw std::runtime_error("Failed to map shader pack file.");
+	}
+}
+
+void ShaderPack::throwIfInvalid(bool invalid) const
+{
+	if (invalid)
+	{
+		throw std::runtime_error("Shader pack is invalid.");
+	}
+}
+
+void ShaderPack::throwShaderNotFound(const char* name) const
+{
+	throw std::runtime_error(std::string("Shader not found in shader pack: ") + name);
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string>
+#include "ShaderPackHeader.h"
+#include "ShaderPackEntry.h"
+#include "ShaderCode.h"
+
+
+class ShaderPack
+{
+private:
+	const uint32_t PACK_MAGIC = 0x4B415053;
+	const uint32_t PACK_VERSION = 1;
+
+	const unsigned char* data;
+	size_t dataSize;
+	void* mappedView;
+
+	void mapFile(const std::string& path);
+	void unmapFile();
+	const ShaderPackHeader* getHeader() const;
+	const ShaderPackEntry* getEntries() const;
+	void validate() const;
+	void throwIfMapFailed(bool failed) const;
+	void throwIfInvalid(bool invalid) const;
+	void throwShaderNotFound(const char* name) const;
+
+public:
+	ShaderPack(const std::string& path);
+	ShaderPack(const void* data, size_t dataSize);
+	~ShaderPack();
+
+	ShaderCode getShaderCode(const char* name) const;
+};
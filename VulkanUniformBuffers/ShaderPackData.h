@@ -0,0 +1,436 @@
+#pragma once
+
+#include <cstdint>
+
+constexpr uint32_t SHADER_PACK_DATA[] =
+{
+	0x4b415053, 0x00000001, 0x00000007, 0x74726576, 0x732e7865, 0x00007670, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000124, 0x000007c8, 0x74726576, 0x705f7865, 0x756d6572,
+	0x7069746c, 0x6465696c, 0x7670732e, 0x00000000, 0x00000000, 0x000008ec, 0x00000790, 0x67617266,
+	0x746e656d, 0x7670732e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000107c,
+	0x00000260, 0x6c6c7563, 0x7670732e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x000012dc, 0x00001494, 0x636e6562, 0x72616d68, 0x75705f6b, 0x732e6873, 0x00007670,
+	0x00000000, 0x00000000, 0x00000000, 0x00002770, 0x000003e0, 0x636e6562, 0x72616d68, 0x6e755f6b,
+	0x726f6669, 0x70732e6d, 0x00000076, 0x00000000, 0x00000000, 0x00002b50, 0x000004a8, 0x636e6562,
+	0x72616d68, 0x74735f6b, 0x6761726f, 0x70732e65, 0x00000076, 0x00000000, 0x00000000, 0x00002ff8,
+	0x00000598, 0x07230203, 0x00010000, 0x00000000, 0x0000003a, 0x00000000, 0x00020011, 0x00000001,
+	0x0003000e, 0x00000000, 0x00000001, 0x000b000f, 0x00000000, 0x0000001d, 0x6e69616d, 0x00000000,
+	0x0000000b, 0x00000013, 0x00000014, 0x00000016, 0x00000018, 0x0000001a, 0x00060005, 0x00000009,
+	0x505f6c67, 0x65567265, 0x78657472, 0x00000000, 0x00060006, 0x00000009, 0x00000000, 0x505f6c67,
+	0x7469736f, 0x006e6f69, 0x00070006, 0x00000009, 0x00000001, 0x505f6c67, 0x746e696f, 0x657a6953,
+	0x00000000, 0x00070006, 0x00000009, 0x00000002, 0x435f6c67, 0x4470696c, 0x61747369, 0x0065636e,
+	0x00070006, 0x00000009, 0x00000003, 0x435f6c67, 0x446c6c75, 0x61747369, 0x0065636e, 0x00030005,
+	0x0000000b, 0x00000000, 0x00070005, 0x0000000c, 0x66696e55, 0x426d726f, 0x65666675, 0x6a624f72,
+	0x00746365, 0x00050006, 0x0000000c, 0x00000000, 0x77656976, 0x00000000, 0x00060006, 0x0000000c,
+	0x00000001, 0x6a6f7270, 0x69746365, 0x00006e6f, 0x00070006, 0x0000000c, 0x00000002, 0x77656976,
+	0x6a6f7250, 0x69746365, 0x00006e6f, 0x00030005, 0x0000000e, 0x006f6275, 0x00070005, 0x0000000f,
+	0x656a624f, 0x75507463, 0x6f436873, 0x6174736e, 0x0073746e, 0x00050006, 0x0000000f, 0x00000000,
+	0x65646f6d, 0x0000006c, 0x00040005, 0x00000011, 0x656a626f, 0x00007463, 0x00060005, 0x00000013,
+	0x74726576, 0x69736f50, 0x6e6f6974, 0x00000000, 0x00050005, 0x00000014, 0x74726576, 0x6f6c6f43,
+	0x00000072, 0x00060005, 0x00000016, 0x74736e69, 0x65636e61, 0x65646f4d, 0x0000006c, 0x00060005,
+	0x00000018, 0x74736e69, 0x65636e61, 0x6f6c6f43, 0x00000072, 0x00050005, 0x0000001a, 0x67617266,
+	0x6f6c6f43, 0x00000072, 0x00040005, 0x0000001d, 0x6e69616d, 0x00000000, 0x00050048, 0x00000009,
+	0x00000000, 0x0000000b, 0x00000000, 0x00050048, 0x00000009, 0x00000001, 0x0000000b, 0x00000001,
+	0x00050048, 0x00000009, 0x00000002, 0x0000000b, 0x00000003, 0x00050048, 0x00000009, 0x00000003,
+	0x0000000b, 0x00000004, 0x00030047, 0x00000009, 0x00000002, 0x00040048, 0x0000000c, 0x00000000,
+	0x00000005, 0x00050048, 0x0000000c, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000000c,
+	0x00000000, 0x00000007, 0x00000010, 0x00040048, 0x0000000c, 0x00000001, 0x00000005, 0x00050048,
+	0x0000000c, 0x00000001, 0x00000023, 0x00000040, 0x00050048, 0x0000000c, 0x00000001, 0x00000007,
+	0x00000010, 0x00040048, 0x0000000c, 0x00000002, 0x00000005, 0x00050048, 0x0000000c, 0x00000002,
+	0x00000023, 0x00000080, 0x00050048, 0x0000000c, 0x00000002, 0x00000007, 0x00000010, 0x00030047,
+	0x0000000c, 0x00000002, 0x00040047, 0x0000000e, 0x00000022, 0x00000000, 0x00040047, 0x0000000e,
+	0x00000021, 0x00000000, 0x00040048, 0x0000000f, 0x00000000, 0x00000005, 0x00050048, 0x0000000f,
+	0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000000f, 0x00000000, 0x00000007, 0x00000010,
+	0x00030047, 0x0000000f, 0x00000002, 0x00040047, 0x00000013, 0x0000001e, 0x00000000, 0x00040047,
+	0x00000014, 0x0000001e, 0x00000001, 0x00040047, 0x00000016, 0x0000001e, 0x00000002, 0x00040047,
+	0x00000018, 0x0000001e, 0x00000006, 0x00040047, 0x0000001a, 0x0000001e, 0x00000000, 0x00030016,
+	0x00000001, 0x00000020, 0x00040017, 0x00000002, 0x00000001, 0x00000003, 0x00040017, 0x00000003,
+	0x00000001, 0x00000004, 0x00040018, 0x00000004, 0x00000003, 0x00000004, 0x00040015, 0x00000005,
+	0x00000020, 0x00000000, 0x00040015, 0x00000006, 0x00000020, 0x00000001, 0x0004002b, 0x00000005,
+	0x00000007, 0x00000001, 0x0004001c, 0x00000008, 0x00000001, 0x00000007, 0x0006001e, 0x00000009,
+	0x00000003, 0x00000001, 0x00000008, 0x00000008, 0x00040020, 0x0000000a, 0x00000003, 0x00000009,
+	0x0004003b, 0x0000000a, 0x0000000b, 0x00000003, 0x0005001e, 0x0000000c, 0x00000004, 0x00000004,
+	0x00000004, 0x00040020, 0x0000000d, 0x00000002, 0x0000000c, 0x0004003b, 0x0000000d, 0x0000000e,
+	0x00000002, 0x0003001e, 0x0000000f, 0x00000004, 0x00040020, 0x00000010, 0x00000009, 0x0000000f,
+	0x0004003b, 0x00000010, 0x00000011, 0x00000009, 0x00040020, 0x00000012, 0x00000001, 0x00000002,
+	0x0004003b, 0x00000012, 0x00000013, 0x00000001, 0x0004003b, 0x00000012, 0x00000014, 0x00000001,
+	0x00040020, 0x00000015, 0x00000001, 0x00000004, 0x0004003b, 0x00000015, 0x00000016, 0x00000001,
+	0x00040020, 0x00000017, 0x00000001, 0x00000003, 0x0004003b, 0x00000017, 0x00000018, 0x00000001,
+	0x00040020, 0x00000019, 0x00000003, 0x00000002, 0x0004003b, 0x00000019, 0x0000001a, 0x00000003,
+	0x00020013, 0x0000001b, 0x00030021, 0x0000001c, 0x0000001b, 0x0004002b, 0x00000001, 0x00000020,
+	0x3f800000, 0x0004002b, 0x00000006, 0x00000025, 0x00000000, 0x00040020, 0x00000026, 0x00000009,
+	0x00000004, 0x0004002b, 0x00000006, 0x0000002a, 0x00000001, 0x00040020, 0x0000002b, 0x00000002,
+	0x00000004, 0x00040020, 0x00000034, 0x00000003, 0x00000003, 0x00050036, 0x0000001b, 0x0000001d,
+	0x00000000, 0x0000001c, 0x000200f8, 0x0000001e, 0x0004003d, 0x00000002, 0x0000001f, 0x00000013,
+	0x00050051, 0x00000001, 0x00000021, 0x0000001f, 0x00000000, 0x00050051, 0x00000001, 0x00000022,
+	0x0000001f, 0x00000001, 0x00050051, 0x00000001, 0x00000023, 0x0000001f, 0x00000002, 0x00070050,
+	0x00000003, 0x00000024, 0x00000021, 0x00000022, 0x00000023, 0x00000020, 0x00050041, 0x00000026,
+	0x00000027, 0x00000011, 0x00000025, 0x0004003d, 0x00000004, 0x00000028, 0x00000027, 0x0004003d,
+	0x00000004, 0x00000029, 0x00000016, 0x00050041, 0x0000002b, 0x0000002c, 0x0000000e, 0x0000002a,
+	0x0004003d, 0x00000004, 0x0000002d, 0x0000002c, 0x00050041, 0x0000002b, 0x0000002e, 0x0000000e,
+	0x00000025, 0x0004003d, 0x00000004, 0x0000002f, 0x0000002e, 0x00050092, 0x00000004, 0x00000030,
+	0x0000002d, 0x0000002f, 0x00050092, 0x00000004, 0x00000031, 0x00000030, 0x00000028, 0x00050092,
+	0x00000004, 0x00000032, 0x00000031, 0x00000029, 0x00050091, 0x00000003, 0x00000033, 0x00000032,
+	0x00000024, 0x00050041, 0x00000034, 0x00000035, 0x0000000b, 0x00000025, 0x0003003e, 0x00000035,
+	0x00000033, 0x0004003d, 0x00000003, 0x00000036, 0x00000018, 0x0004003d, 0x00000002, 0x00000037,
+	0x00000014, 0x0008004f, 0x00000002, 0x00000038, 0x00000036, 0x00000036, 0x00000000, 0x00000001,
+	0x00000002, 0x00050085, 0x00000002, 0x00000039, 0x00000037, 0x00000038, 0x0003003e, 0x0000001a,
+	0x00000039, 0x000100fd, 0x00010038, 0x07230203, 0x00010000, 0x00000000, 0x00000037, 0x00000000,
+	0x00020011, 0x00000001, 0x0003000e, 0x00000000, 0x00000001, 0x000b000f, 0x00000000, 0x0000001d,
+	0x6e69616d, 0x00000000, 0x0000000b, 0x00000013, 0x00000014, 0x00000016, 0x00000018, 0x0000001a,
+	0x00060005, 0x00000009, 0x505f6c67, 0x65567265, 0x78657472, 0x00000000, 0x00060006, 0x00000009,
+	0x00000000, 0x505f6c67, 0x7469736f, 0x006e6f69, 0x00070006, 0x00000009, 0x00000001, 0x505f6c67,
+	0x746e696f, 0x657a6953, 0x00000000, 0x00070006, 0x00000009, 0x00000002, 0x435f6c67, 0x4470696c,
+	0x61747369, 0x0065636e, 0x00070006, 0x00000009, 0x00000003, 0x435f6c67, 0x446c6c75, 0x61747369,
+	0x0065636e, 0x00030005, 0x0000000b, 0x00000000, 0x00070005, 0x0000000c, 0x66696e55, 0x426d726f,
+	0x65666675, 0x6a624f72, 0x00746365, 0x00050006, 0x0000000c, 0x00000000, 0x77656976, 0x00000000,
+	0x00060006, 0x0000000c, 0x00000001, 0x6a6f7270, 0x69746365, 0x00006e6f, 0x00070006, 0x0000000c,
+	0x00000002, 0x77656976, 0x6a6f7250, 0x69746365, 0x00006e6f, 0x00030005, 0x0000000e, 0x006f6275,
+	0x00070005, 0x0000000f, 0x656a624f, 0x75507463, 0x6f436873, 0x6174736e, 0x0073746e, 0x00050006,
+	0x0000000f, 0x00000000, 0x65646f6d, 0x0000006c, 0x00040005, 0x00000011, 0x656a626f, 0x00007463,
+	0x00060005, 0x00000013, 0x74726576, 0x69736f50, 0x6e6f6974, 0x00000000, 0x00050005, 0x00000014,
+	0x74726576, 0x6f6c6f43, 0x00000072, 0x00060005, 0x00000016, 0x74736e69, 0x65636e61, 0x65646f4d,
+	0x0000006c, 0x00060005, 0x00000018, 0x74736e69, 0x65636e61, 0x6f6c6f43, 0x00000072, 0x00050005,
+	0x0000001a, 0x67617266, 0x6f6c6f43, 0x00000072, 0x00040005, 0x0000001d, 0x6e69616d, 0x00000000,
+	0x00050048, 0x00000009, 0x00000000, 0x0000000b, 0x00000000, 0x00050048, 0x00000009, 0x00000001,
+	0x0000000b, 0x00000001, 0x00050048, 0x00000009, 0x00000002, 0x0000000b, 0x00000003, 0x00050048,
+	0x00000009, 0x00000003, 0x0000000b, 0x00000004, 0x00030047, 0x00000009, 0x00000002, 0x00040048,
+	0x0000000c, 0x00000000, 0x00000005, 0x00050048, 0x0000000c, 0x00000000, 0x00000023, 0x00000000,
+	0x00050048, 0x0000000c, 0x00000000, 0x00000007, 0x00000010, 0x00040048, 0x0000000c, 0x00000001,
+	0x00000005, 0x00050048, 0x0000000c, 0x00000001, 0x00000023, 0x00000040, 0x00050048, 0x0000000c,
+	0x00000001, 0x00000007, 0x00000010, 0x00040048, 0x0000000c, 0x00000002, 0x00000005, 0x00050048,
+	0x0000000c, 0x00000002, 0x00000023, 0x00000080, 0x00050048, 0x0000000c, 0x00000002, 0x00000007,
+	0x00000010, 0x00030047, 0x0000000c, 0x00000002, 0x00040047, 0x0000000e, 0x00000022, 0x00000000,
+	0x00040047, 0x0000000e, 0x00000021, 0x00000000, 0x00040048, 0x0000000f, 0x00000000, 0x00000005,
+	0x00050048, 0x0000000f, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000000f, 0x00000000,
+	0x00000007, 0x00000010, 0x00030047, 0x0000000f, 0x00000002, 0x00040047, 0x00000013, 0x0000001e,
+	0x00000000, 0x00040047, 0x00000014, 0x0000001e, 0x00000001, 0x00040047, 0x00000016, 0x0000001e,
+	0x00000002, 0x00040047, 0x00000018, 0x0000001e, 0x00000006, 0x00040047, 0x0000001a, 0x0000001e,
+	0x00000000, 0x00030016, 0x00000001, 0x00000020, 0x00040017, 0x00000002, 0x00000001, 0x00000003,
+	0x00040017, 0x00000003, 0x00000001, 0x00000004, 0x00040018, 0x00000004, 0x00000003, 0x00000004,
+	0x00040015, 0x00000005, 0x00000020, 0x00000000, 0x00040015, 0x00000006, 0x00000020, 0x00000001,
+	0x0004002b, 0x00000005, 0x00000007, 0x00000001, 0x0004001c, 0x00000008, 0x00000001, 0x00000007,
+	0x0006001e, 0x00000009, 0x00000003, 0x00000001, 0x00000008, 0x00000008, 0x00040020, 0x0000000a,
+	0x00000003, 0x00000009, 0x0004003b, 0x0000000a, 0x0000000b, 0x00000003, 0x0005001e, 0x0000000c,
+	0x00000004, 0x00000004, 0x00000004, 0x00040020, 0x0000000d, 0x00000002, 0x0000000c, 0x0004003b,
+	0x0000000d, 0x0000000e, 0x00000002, 0x0003001e, 0x0000000f, 0x00000004, 0x00040020, 0x00000010,
+	0x00000009, 0x0000000f, 0x0004003b, 0x00000010, 0x00000011, 0x00000009, 0x00040020, 0x00000012,
+	0x00000001, 0x00000002, 0x0004003b, 0x00000012, 0x00000013, 0x00000001, 0x0004003b, 0x00000012,
+	0x00000014, 0x00000001, 0x00040020, 0x00000015, 0x00000001, 0x00000004, 0x0004003b, 0x00000015,
+	0x00000016, 0x00000001, 0x00040020, 0x00000017, 0x00000001, 0x00000003, 0x0004003b, 0x00000017,
+	0x00000018, 0x00000001, 0x00040020, 0x00000019, 0x00000003, 0x00000002, 0x0004003b, 0x00000019,
+	0x0000001a, 0x00000003, 0x00020013, 0x0000001b, 0x00030021, 0x0000001c, 0x0000001b, 0x0004002b,
+	0x00000001, 0x00000020, 0x3f800000, 0x0004002b, 0x00000006, 0x00000025, 0x00000000, 0x00040020,
+	0x00000026, 0x00000009, 0x00000004, 0x0004002b, 0x00000006, 0x0000002a, 0x00000002, 0x00040020,
+	0x0000002b, 0x00000002, 0x00000004, 0x00040020, 0x00000031, 0x00000003, 0x00000003, 0x00050036,
+	0x0000001b, 0x0000001d, 0x00000000, 0x0000001c, 0x000200f8, 0x0000001e, 0x0004003d, 0x00000002,
+	0x0000001f, 0x00000013, 0x00050051, 0x00000001, 0x00000021, 0x0000001f, 0x00000000, 0x00050051,
+	0x00000001, 0x00000022, 0x0000001f, 0x00000001, 0x00050051, 0x00000001, 0x00000023, 0x0000001f,
+	0x00000002, 0x00070050, 0x00000003, 0x00000024, 0x00000021, 0x00000022, 0x00000023, 0x00000020,
+	0x00050041, 0x00000026, 0x00000027, 0x00000011, 0x00000025, 0x0004003d, 0x00000004, 0x00000028,
+	0x00000027, 0x0004003d, 0x00000004, 0x00000029, 0x00000016, 0x00050041, 0x0000002b, 0x0000002c,
+	0x0000000e, 0x0000002a, 0x0004003d, 0x00000004, 0x0000002d, 0x0000002c, 0x00050091, 0x00000003,
+	0x0000002e, 0x00000029, 0x00000024, 0x00050091, 0x00000003, 0x0000002f, 0x00000028, 0x0000002e,
+	0x00050091, 0x00000003, 0x00000030, 0x0000002d, 0x0000002f, 0x00050041, 0x00000031, 0x00000032,
+	0x0000000b, 0x00000025, 0x0003003e, 0x00000032, 0x00000030, 0x0004003d, 0x00000003, 0x00000033,
+	0x00000018, 0x0004003d, 0x00000002, 0x00000034, 0x00000014, 0x0008004f, 0x00000002, 0x00000035,
+	0x00000033, 0x00000033, 0x00000000, 0x00000001, 0x00000002, 0x00050085, 0x00000002, 0x00000036,
+	0x00000034, 0x00000035, 0x0003003e, 0x0000001a, 0x00000036, 0x000100fd, 0x00010038, 0x07230203,
+	0x00010000, 0x000d0008, 0x00000013, 0x00000000, 0x00020011, 0x00000001, 0x0006000b, 0x00000001,
+	0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001, 0x0007000f,
+	0x00000004, 0x00000004, 0x6e69616d, 0x00000000, 0x00000009, 0x0000000c, 0x00030010, 0x00000004,
+	0x00000007, 0x00030003, 0x00000002, 0x000001c2, 0x00090004, 0x415f4c47, 0x735f4252, 0x72617065,
+	0x5f657461, 0x64616873, 0x6f5f7265, 0x63656a62, 0x00007374, 0x000a0004, 0x475f4c47, 0x4c474f4f,
+	0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365, 0x00006576, 0x00080004,
+	0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572, 0x00657669, 0x00040005,
+	0x00000004, 0x6e69616d, 0x00000000, 0x00050005, 0x00000009, 0x4374756f, 0x726f6c6f, 0x00000000,
+	0x00050005, 0x0000000c, 0x67617266, 0x6f6c6f43, 0x00000072, 0x00040047, 0x00000009, 0x0000001e,
+	0x00000000, 0x00040047, 0x0000000c, 0x0000001e, 0x00000000, 0x00020013, 0x00000002, 0x00030021,
+	0x00000003, 0x00000002, 0x00030016, 0x00000006, 0x00000020, 0x00040017, 0x00000007, 0x00000006,
+	0x00000004, 0x00040020, 0x00000008, 0x00000003, 0x00000007, 0x0004003b, 0x00000008, 0x00000009,
+	0x00000003, 0x00040017, 0x0000000a, 0x00000006, 0x00000003, 0x00040020, 0x0000000b, 0x00000001,
+	0x0000000a, 0x0004003b, 0x0000000b, 0x0000000c, 0x00000001, 0x0004002b, 0x00000006, 0x0000000e,
+	0x3f800000, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005,
+	0x0004003d, 0x0000000a, 0x0000000d, 0x0000000c, 0x00050051, 0x00000006, 0x0000000f, 0x0000000d,
+	0x00000000, 0x00050051, 0x00000006, 0x00000010, 0x0000000d, 0x00000001, 0x00050051, 0x00000006,
+	0x00000011, 0x0000000d, 0x00000002, 0x00070050, 0x00000007, 0x00000012, 0x0000000f, 0x00000010,
+	0x00000011, 0x0000000e, 0x0003003e, 0x00000009, 0x00000012, 0x000100fd, 0x00010038, 0x07230203,
+	0x00010000, 0x00000000, 0x000000a4, 0x00000000, 0x00020011, 0x00000001, 0x0006000b, 0x00000050,
+	0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001, 0x0006000f,
+	0x00000005, 0x00000024, 0x6e69616d, 0x00000000, 0x0000000a, 0x00060010, 0x00000024, 0x00000011,
+	0x00000040, 0x00000001, 0x00000001, 0x00080005, 0x0000000a, 0x475f6c67, 0x61626f6c, 0x766e496c,
+	0x7461636f, 0x496e6f69, 0x00000044, 0x00060005, 0x0000000b, 0x74736e49, 0x65636e61, 0x61746144,
+	0x00000000, 0x00050006, 0x0000000b, 0x00000000, 0x65646f6d, 0x0000006c, 0x00050006, 0x0000000b,
+	0x00000001, 0x6f6c6f63, 0x00000072, 0x00090005, 0x0000000d, 0x77617244, 0x65646e49, 0x49646578,
+	0x7269646e, 0x43746365, 0x616d6d6f, 0x0000646e, 0x00060006, 0x0000000d, 0x00000000, 0x65646e69,
+	0x756f4378, 0x0000746e, 0x00070006, 0x0000000d, 0x00000001, 0x74736e69, 0x65636e61, 0x6e756f43,
+	0x00000074, 0x00060006, 0x0000000d, 0x00000002, 0x73726966, 0x646e4974, 0x00007865, 0x00070006,
+	0x0000000d, 0x00000003, 0x74726576, 0x664f7865, 0x74657366, 0x00000000, 0x00070006, 0x0000000d,
+	0x00000004, 0x73726966, 0x736e4974, 0x636e6174, 0x00000065, 0x00070005, 0x0000000e, 0x66696e55,
+	0x426d726f, 0x65666675, 0x6a624f72, 0x00746365, 0x00050006, 0x0000000e, 0x00000000, 0x77656976,
+	0x00000000, 0x00060006, 0x0000000e, 0x00000001, 0x6a6f7270, 0x69746365, 0x00006e6f, 0x00070006,
+	0x0000000e, 0x00000002, 0x77656976, 0x6a6f7250, 0x69746365, 0x00006e6f, 0x00030005, 0x00000010,
+	0x006f6275, 0x00060005, 0x00000011, 0x72756f53, 0x6e496563, 0x6e617473, 0x00736563, 0x00060006,
+	0x00000011, 0x00000000, 0x74736e69, 0x65636e61, 0x00000073, 0x00040005, 0x00000013, 0x72756f73,
+	0x00006563, 0x00060005, 0x00000014, 0x72756f53, 0x6f436563, 0x6e616d6d, 0x00000064, 0x00050006,
+	0x00000014, 0x00000000, 0x6d6d6f63, 0x00646e61, 0x00060005, 0x00000016, 0x72756f73, 0x6f436563,
+	0x6e616d6d, 0x00000064, 0x00070005, 0x00000017, 0x69736956, 0x49656c62, 0x6174736e, 0x7365636e,
+	0x00000000, 0x00060006, 0x00000017, 0x00000000, 0x74736e69, 0x65636e61, 0x00000073, 0x00040005,
+	0x00000019, 0x69736976, 0x00656c62, 0x00070005, 0x0000001a, 0x6c6c7543, 0x72446465, 0x6f437761,
+	0x6e616d6d, 0x00000064, 0x00050006, 0x0000001a, 0x00000000, 0x6d6d6f63, 0x00646e61, 0x00060006,
+	0x0000001a, 0x00000001, 0x77617264, 0x6e756f43, 0x00000074, 0x00060005, 0x0000001c, 0x69736956,
+	0x43656c62, 0x616d6d6f, 0x0073646e, 0x00060006, 0x0000001c, 0x00000000, 0x6d6d6f63, 0x73646e61,
+	0x00000000, 0x00060005, 0x0000001e, 0x69736976, 0x43656c62, 0x616d6d6f, 0x0073646e, 0x00080005,
+	0x0000001f, 0x6c6c7543, 0x50676e69, 0x43687375, 0x74736e6f, 0x73746e61, 0x00000000, 0x00060006,
+	0x0000001f, 0x00000000, 0x656a626f, 0x6f4d7463, 0x006c6564, 0x00060006, 0x0000001f, 0x00000001,
+	0x6873656d, 0x69646152, 0x00007375, 0x00060006, 0x0000001f, 0x00000002, 0x656a626f, 0x6e497463,
+	0x00786564, 0x00060006, 0x0000001f, 0x00000003, 0x69736976, 0x42656c62, 0x00657361, 0x00040005,
+	0x00000021, 0x6c6c7563, 0x00000000, 0x00040005, 0x00000024, 0x6e69616d, 0x00000000, 0x00040047,
+	0x0000000a, 0x0000000b, 0x0000001c, 0x00040048, 0x0000000b, 0x00000000, 0x00000005, 0x00050048,
+	0x0000000b, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000000b, 0x00000000, 0x00000007,
+	0x00000010, 0x00050048, 0x0000000b, 0x00000001, 0x00000023, 0x00000040, 0x00040047, 0x0000000c,
+	0x00000006, 0x00000050, 0x00050048, 0x0000000d, 0x00000000, 0x00000023, 0x00000000, 0x00050048,
+	0x0000000d, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x0000000d, 0x00000002, 0x00000023,
+	0x00000008, 0x00050048, 0x0000000d, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x0000000d,
+	0x00000004, 0x00000023, 0x00000010, 0x00040048, 0x0000000e, 0x00000000, 0x00000005, 0x00050048,
+	0x0000000e, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000000e, 0x00000000, 0x00000007,
+	0x00000010, 0x00040048, 0x0000000e, 0x00000001, 0x00000005, 0x00050048, 0x0000000e, 0x00000001,
+	0x00000023, 0x00000040, 0x00050048, 0x0000000e, 0x00000001, 0x00000007, 0x00000010, 0x00040048,
+	0x0000000e, 0x00000002, 0x00000005, 0x00050048, 0x0000000e, 0x00000002, 0x00000023, 0x00000080,
+	0x00050048, 0x0000000e, 0x00000002, 0x00000007, 0x00000010, 0x00030047, 0x0000000e, 0x00000002,
+	0x00040047, 0x00000010, 0x00000022, 0x00000000, 0x00040047, 0x00000010, 0x00000021, 0x00000000,
+	0x00040048, 0x00000011, 0x00000000, 0x00000018, 0x00050048, 0x00000011, 0x00000000, 0x00000023,
+	0x00000000, 0x00030047, 0x00000011, 0x00000003, 0x00040047, 0x00000013, 0x00000022, 0x00000000,
+	0x00040047, 0x00000013, 0x00000021, 0x00000001, 0x00040048, 0x00000014, 0x00000000, 0x00000018,
+	0x00050048, 0x00000014, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000014, 0x00000003,
+	0x00040047, 0x00000016, 0x00000022, 0x00000000, 0x00040047, 0x00000016, 0x00000021, 0x00000002,
+	0x00040048, 0x00000017, 0x00000000, 0x00000019, 0x00050048, 0x00000017, 0x00000000, 0x00000023,
+	0x00000000, 0x00030047, 0x00000017, 0x00000003, 0x00040047, 0x00000019, 0x00000022, 0x00000000,
+	0x00040047, 0x00000019, 0x00000021, 0x00000003, 0x00050048, 0x0000001a, 0x00000000, 0x00000023,
+	0x00000000, 0x00050048, 0x0000001a, 0x00000001, 0x00000023, 0x00000014, 0x00040047, 0x0000001b,
+	0x00000006, 0x00000018, 0x00050048, 0x0000001c, 0x00000000, 0x00000023, 0x00000000, 0x00030047,
+	0x0000001c, 0x00000003, 0x00040047, 0x0000001e, 0x00000022, 0x00000000, 0x00040047, 0x0000001e,
+	0x00000021, 0x00000004, 0x00040048, 0x0000001f, 0x00000000, 0x00000005, 0x00050048, 0x0000001f,
+	0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000001f, 0x00000000, 0x00000007, 0x00000010,
+	0x00050048, 0x0000001f, 0x00000001, 0x00000023, 0x00000040, 0x00050048, 0x0000001f, 0x00000002,
+	0x00000023, 0x00000044, 0x00050048, 0x0000001f, 0x00000003, 0x00000023, 0x00000048, 0x00030047,
+	0x0000001f, 0x00000002, 0x00030016, 0x00000001, 0x00000020, 0x00040017, 0x00000002, 0x00000001,
+	0x00000003, 0x00040017, 0x00000003, 0x00000001, 0x00000004, 0x00040018, 0x00000004, 0x00000003,
+	0x00000004, 0x00040015, 0x00000005, 0x00000020, 0x00000000, 0x00040015, 0x00000006, 0x00000020,
+	0x00000001, 0x00040017, 0x00000007, 0x00000005, 0x00000003, 0x00020014, 0x00000008, 0x00040020,
+	0x00000009, 0x00000001, 0x00000007, 0x0004003b, 0x00000009, 0x0000000a, 0x00000001, 0x0004001e,
+	0x0000000b, 0x00000004, 0x00000003, 0x0003001d, 0x0000000c, 0x0000000b, 0x0007001e, 0x0000000d,
+	0x00000005, 0x00000005, 0x00000005, 0x00000006, 0x00000005, 0x0005001e, 0x0000000e, 0x00000004,
+	0x00000004, 0x00000004, 0x00040020, 0x0000000f, 0x00000002, 0x0000000e, 0x0004003b, 0x0000000f,
+	0x00000010, 0x00000002, 0x0003001e, 0x00000011, 0x0000000c, 0x00040020, 0x00000012, 0x00000002,
+	0x00000011, 0x0004003b, 0x00000012, 0x00000013, 0x00000002, 0x0003001e, 0x00000014, 0x0000000d,
+	0x00040020, 0x00000015, 0x00000002, 0x00000014, 0x0004003b, 0x00000015, 0x00000016, 0x00000002,
+	0x0003001e, 0x00000017, 0x0000000c, 0x00040020, 0x00000018, 0x00000002, 0x00000017, 0x0004003b,
+	0x00000018, 0x00000019, 0x00000002, 0x0004001e, 0x0000001a, 0x0000000d, 0x00000005, 0x0003001d,
+	0x0000001b, 0x0000001a, 0x0003001e, 0x0000001c, 0x0000001b, 0x00040020, 0x0000001d, 0x00000002,
+	0x0000001c, 0x0004003b, 0x0000001d, 0x0000001e, 0x00000002, 0x0006001e, 0x0000001f, 0x00000004,
+	0x00000001, 0x00000005, 0x00000005, 0x00040020, 0x00000020, 0x00000009, 0x0000001f, 0x0004003b,
+	0x00000020, 0x00000021, 0x00000009, 0x00020013, 0x00000022, 0x00030021, 0x00000023, 0x00000022,
+	0x0004002b, 0x00000006, 0x00000028, 0x00000002, 0x00040020, 0x00000029, 0x00000009, 0x00000005,
+	0x0004002b, 0x00000005, 0x0000002e, 0x00000000, 0x0004002b, 0x00000006, 0x00000030, 0x00000000,
+	0x00040020, 0x00000031, 0x00000002, 0x00000005, 0x0004002b, 0x00000006, 0x00000036, 0x00000003,
+	0x00040020, 0x00000037, 0x00000002, 0x00000006, 0x0004002b, 0x00000006, 0x00000039, 0x00000004,
+	0x0004002b, 0x00000006, 0x0000003d, 0x00000001, 0x00040020, 0x00000041, 0x00000002, 0x00000004,
+	0x00040020, 0x00000044, 0x00000002, 0x00000003, 0x00040020, 0x00000047, 0x00000009, 0x00000004,
+	0x00040020, 0x00000058, 0x00000009, 0x00000001, 0x0004002b, 0x00000005, 0x0000009e, 0x00000001,
+	0x00050036, 0x00000022, 0x00000024, 0x00000000, 0x00000023, 0x000200f8, 0x00000025, 0x0004003d,
+	0x00000007, 0x00000026, 0x0000000a, 0x00050051, 0x00000005, 0x00000027, 0x00000026, 0x00000000,
+	0x00050041, 0x00000029, 0x0000002a, 0x00000021, 0x00000028, 0x0004003d, 0x00000005, 0x0000002b,
+	0x0000002a, 0x000500aa, 0x00000008, 0x0000002f, 0x00000027, 0x0000002e, 0x000300f7, 0x0000002c,
+	0x00000000, 0x000400fa, 0x0000002f, 0x0000002d, 0x0000002c, 0x000200f8, 0x0000002d, 0x00080041,
+	0x00000031, 0x00000032, 0x0000001e, 0x00000030, 0x0000002b, 0x00000030, 0x00000030, 0x00060041,
+	0x00000031, 0x00000033, 0x00000016, 0x00000030, 0x00000030, 0x0004003d, 0x00000005, 0x00000034,
+	0x00000033, 0x0003003e, 0x00000032, 0x00000034, 0x00080041, 0x00000031, 0x00000035, 0x0000001e,
+	0x00000030, 0x0000002b, 0x00000030, 0x00000028, 0x0003003e, 0x00000035, 0x0000002e, 0x00080041,
+	0x00000037, 0x00000038, 0x0000001e, 0x00000030, 0x0000002b, 0x00000030, 0x00000036, 0x0003003e,
+	0x00000038, 0x00000030, 0x00080041, 0x00000031, 0x0000003a, 0x0000001e, 0x00000030, 0x0000002b,
+	0x00000030, 0x00000039, 0x0003003e, 0x0000003a, 0x0000002e, 0x000200f9, 0x0000002c, 0x000200f8,
+	0x0000002c, 0x00060041, 0x00000031, 0x0000003e, 0x00000016, 0x00000030, 0x0000003d, 0x0004003d,
+	0x00000005, 0x0000003f, 0x0000003e, 0x000500ae, 0x00000008, 0x00000040, 0x00000027, 0x0000003f,
+	0x000300f7, 0x0000003b, 0x00000000, 0x000400fa, 0x00000040, 0x0000003c, 0x0000003b, 0x000200f8,
+	0x0000003c, 0x000100fd, 0x000200f8, 0x0000003b, 0x00070041, 0x00000041, 0x00000042, 0x00000013,
+	0x00000030, 0x00000027, 0x00000030, 0x0004003d, 0x00000004, 0x00000043, 0x00000042, 0x00070041,
+	0x00000044, 0x00000045, 0x00000013, 0x00000030, 0x00000027, 0x0000003d, 0x0004003d, 0x00000003,
+	0x00000046, 0x00000045, 0x00050041, 0x00000047, 0x00000048, 0x00000021, 0x00000030, 0x0004003d,
+	0x00000004, 0x00000049, 0x00000048, 0x00050092, 0x00000004, 0x0000004a, 0x00000049, 0x00000043,
+	0x00050051, 0x00000003, 0x0000004b, 0x0000004a, 0x00000000, 0x00050051, 0x00000003, 0x0000004c,
+	0x0000004a, 0x00000001, 0x00050051, 0x00000003, 0x0000004d, 0x0000004a, 0x00000002, 0x00050051,
+	0x00000003, 0x0000004e, 0x0000004a, 0x00000003, 0x0008004f, 0x00000002, 0x0000004f, 0x0000004b,
+	0x0000004b, 0x00000000, 0x00000001, 0x00000002, 0x0006000c, 0x00000001, 0x00000051, 0x00000050,
+	0x00000042, 0x0000004f, 0x0008004f, 0x00000002, 0x00000052, 0x0000004c, 0x0000004c, 0x00000000,
+	0x00000001, 0x00000002, 0x0006000c, 0x00000001, 0x00000053, 0x00000050, 0x00000042, 0x00000052,
+	0x0008004f, 0x00000002, 0x00000054, 0x0000004d, 0x0000004d, 0x00000000, 0x00000001, 0x00000002,
+	0x0006000c, 0x00000001, 0x00000055, 0x00000050, 0x00000042, 0x00000054, 0x0007000c, 0x00000001,
+	0x00000056, 0x00000050, 0x00000028, 0x00000053, 0x00000055, 0x0007000c, 0x00000001, 0x00000057,
+	0x00000050, 0x00000028, 0x00000051, 0x00000056, 0x00050041, 0x00000058, 0x00000059, 0x00000021,
+	0x0000003d, 0x0004003d, 0x00000001, 0x0000005a, 0x00000059, 0x00050085, 0x00000001, 0x0000005b,
+	0x0000005a, 0x00000057, 0x0008004f, 0x00000002, 0x0000005c, 0x0000004e, 0x0000004e, 0x00000000,
+	0x00000001, 0x00000002, 0x00050041, 0x00000041, 0x0000005d, 0x00000010, 0x00000028, 0x0004003d,
+	0x00000004, 0x0000005e, 0x0000005d, 0x00040054, 0x00000004, 0x0000005f, 0x0000005e, 0x00050051,
+	0x00000003, 0x00000060, 0x0000005f, 0x00000000, 0x00050051, 0x00000003, 0x00000061, 0x0000005f,
+	0x00000001, 0x00050051, 0x00000003, 0x00000062, 0x0000005f, 0x00000002, 0x00050051, 0x00000003,
+	0x00000063, 0x0000005f, 0x00000003, 0x00050081, 0x00000003, 0x00000064, 0x00000063, 0x00000060,
+	0x00050083, 0x00000003, 0x00000065, 0x00000063, 0x00000060, 0x00050081, 0x00000003, 0x00000066,
+	0x00000063, 0x00000061, 0x00050083, 0x00000003, 0x00000067, 0x00000063, 0x00000061, 0x00050083,
+	0x00000003, 0x00000068, 0x00000063, 0x00000062, 0x0004007f, 0x00000001, 0x00000069, 0x0000005b,
+	0x0008004f, 0x00000002, 0x0000006a, 0x00000064, 0x00000064, 0x00000000, 0x00000001, 0x00000002,
+	0x00050094, 0x00000001, 0x0000006b, 0x0000006a, 0x0000005c, 0x00050051, 0x00000001, 0x0000006c,
+	0x00000064, 0x00000003, 0x00050081, 0x00000001, 0x0000006d, 0x0000006b, 0x0000006c, 0x0006000c,
+	0x00000001, 0x0000006e, 0x00000050, 0x00000042, 0x0000006a, 0x00050085, 0x00000001, 0x0000006f,
+	0x00000069, 0x0000006e, 0x000500b8, 0x00000008, 0x00000070, 0x0000006d, 0x0000006f, 0x0008004f,
+	0x00000002, 0x00000071, 0x00000065, 0x00000065, 0x00000000, 0x00000001, 0x00000002, 0x00050094,
+	0x00000001, 0x00000072, 0x00000071, 0x0000005c, 0x00050051, 0x00000001, 0x00000073, 0x00000065,
+	0x00000003, 0x00050081, 0x00000001, 0x00000074, 0x00000072, 0x00000073, 0x0006000c, 0x00000001,
+	0x00000075, 0x00000050, 0x00000042, 0x00000071, 0x00050085, 0x00000001, 0x00000076, 0x00000069,
+	0x00000075, 0x000500b8, 0x00000008, 0x00000077, 0x00000074, 0x00000076, 0x000500a6, 0x00000008,
+	0x00000078, 0x00000070, 0x00000077, 0x0008004f, 0x00000002, 0x00000079, 0x00000066, 0x00000066,
+	0x00000000, 0x00000001, 0x00000002, 0x00050094, 0x00000001, 0x0000007a, 0x00000079, 0x0000005c,
+	0x00050051, 0x00000001, 0x0000007b, 0x00000066, 0x00000003, 0x00050081, 0x00000001, 0x0000007c,
+	0x0000007a, 0x0000007b, 0x0006000c, 0x00000001, 0x0000007d, 0x00000050, 0x00000042, 0x00000079,
+	0x00050085, 0x00000001, 0x0000007e, 0x00000069, 0x0000007d, 0x000500b8, 0x00000008, 0x0000007f,
+	0x0000007c, 0x0000007e, 0x000500a6, 0x00000008, 0x00000080, 0x00000078, 0x0000007f, 0x0008004f,
+	0x00000002, 0x00000081, 0x00000067, 0x00000067, 0x00000000, 0x00000001, 0x00000002, 0x00050094,
+	0x00000001, 0x00000082, 0x00000081, 0x0000005c, 0x00050051, 0x00000001, 0x00000083, 0x00000067,
+	0x00000003, 0x00050081, 0x00000001, 0x00000084, 0x00000082, 0x00000083, 0x0006000c, 0x00000001,
+	0x00000085, 0x00000050, 0x00000042, 0x00000081, 0x00050085, 0x00000001, 0x00000086, 0x00000069,
+	0x00000085, 0x000500b8, 0x00000008, 0x00000087, 0x00000084, 0x00000086, 0x000500a6, 0x00000008,
+	0x00000088, 0x00000080, 0x00000087, 0x0008004f, 0x00000002, 0x00000089, 0x00000062, 0x00000062,
+	0x00000000, 0x00000001, 0x00000002, 0x00050094, 0x00000001, 0x0000008a, 0x00000089, 0x0000005c,
+	0x00050051, 0x00000001, 0x0000008b, 0x00000062, 0x00000003, 0x00050081, 0x00000001, 0x0000008c,
+	0x0000008a, 0x0000008b, 0x0006000c, 0x00000001, 0x0000008d, 0x00000050, 0x00000042, 0x00000089,
+	0x00050085, 0x00000001, 0x0000008e, 0x00000069, 0x0000008d, 0x000500b8, 0x00000008, 0x0000008f,
+	0x0000008c, 0x0000008e, 0x000500a6, 0x00000008, 0x00000090, 0x00000088, 0x0000008f, 0x0008004f,
+	0x00000002, 0x00000091, 0x00000068, 0x00000068, 0x00000000, 0x00000001, 0x00000002, 0x00050094,
+	0x00000001, 0x00000092, 0x00000091, 0x0000005c, 0x00050051, 0x00000001, 0x00000093, 0x00000068,
+	0x00000003, 0x00050081, 0x00000001, 0x00000094, 0x00000092, 0x00000093, 0x0006000c, 0x00000001,
+	0x00000095, 0x00000050, 0x00000042, 0x00000091, 0x00050085, 0x00000001, 0x00000096, 0x00000069,
+	0x00000095, 0x000500b8, 0x00000008, 0x00000097, 0x00000094, 0x00000096, 0x000500a6, 0x00000008,
+	0x00000098, 0x00000090, 0x00000097, 0x000300f7, 0x00000099, 0x00000000, 0x000400fa, 0x00000098,
+	0x0000009a, 0x00000099, 0x000200f8, 0x0000009a, 0x000100fd, 0x000200f8, 0x00000099, 0x00050041,
+	0x00000029, 0x0000009b, 0x00000021, 0x00000036, 0x0004003d, 0x00000005, 0x0000009c, 0x0000009b,
+	0x00080041, 0x00000031, 0x0000009d, 0x0000001e, 0x00000030, 0x0000002b, 0x00000030, 0x0000003d,
+	0x000700ea, 0x00000005, 0x0000009f, 0x0000009d, 0x0000009e, 0x0000002e, 0x0000009e, 0x00050080,
+	0x00000005, 0x000000a0, 0x0000009c, 0x0000009f, 0x00070041, 0x00000041, 0x000000a1, 0x00000019,
+	0x00000030, 0x000000a0, 0x00000030, 0x0003003e, 0x000000a1, 0x00000043, 0x00070041, 0x00000044,
+	0x000000a2, 0x00000019, 0x00000030, 0x000000a0, 0x0000003d, 0x0003003e, 0x000000a2, 0x00000046,
+	0x00070041, 0x00000031, 0x000000a3, 0x0000001e, 0x00000030, 0x0000002b, 0x0000003d, 0x0003003e,
+	0x000000a3, 0x0000009e, 0x000100fd, 0x00010038, 0x07230203, 0x00010000, 0x00000000, 0x0000001f,
+	0x00000000, 0x00020011, 0x00000001, 0x0003000e, 0x00000000, 0x00000001, 0x0005000f, 0x00000005,
+	0x00000010, 0x6e69616d, 0x00000000, 0x00060010, 0x00000010, 0x00000011, 0x00000001, 0x00000001,
+	0x00000001, 0x00040005, 0x00000008, 0x75736552, 0x0073746c, 0x00060006, 0x00000008, 0x00000000,
+	0x69736f70, 0x6e6f6974, 0x00000073, 0x00040005, 0x0000000a, 0x75736572, 0x0073746c, 0x000a0005,
+	0x0000000b, 0x66696e55, 0x426d726f, 0x68636e65, 0x6b72616d, 0x68737550, 0x736e6f43, 0x746e6174,
+	0x00000073, 0x00050006, 0x0000000b, 0x00000000, 0x65646f6d, 0x0000006c, 0x00060006, 0x0000000b,
+	0x00000001, 0x656a626f, 0x6e497463, 0x00786564, 0x00060006, 0x0000000b, 0x00000002, 0x656a626f,
+	0x6f437463, 0x00746e75, 0x00040005, 0x0000000d, 0x656a626f, 0x00007463, 0x00040005, 0x00000010,
+	0x6e69616d, 0x00000000, 0x00040047, 0x00000007, 0x00000006, 0x00000010, 0x00040048, 0x00000008,
+	0x00000000, 0x00000019, 0x00050048, 0x00000008, 0x00000000, 0x00000023, 0x00000000, 0x00030047,
+	0x00000008, 0x00000003, 0x00040047, 0x0000000a, 0x00000022, 0x00000000, 0x00040047, 0x0000000a,
+	0x00000021, 0x00000002, 0x00040048, 0x0000000b, 0x00000000, 0x00000005, 0x00050048, 0x0000000b,
+	0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000000b, 0x00000000, 0x00000007, 0x00000010,
+	0x00050048, 0x0000000b, 0x00000001, 0x00000023, 0x00000040, 0x00050048, 0x0000000b, 0x00000002,
+	0x00000023, 0x00000044, 0x00030047, 0x0000000b, 0x00000002, 0x00030016, 0x00000001, 0x00000020,
+	0x00040017, 0x00000002, 0x00000001, 0x00000004, 0x00040018, 0x00000003, 0x00000002, 0x00000004,
+	0x00040015, 0x00000004, 0x00000020, 0x00000000, 0x00040015, 0x00000005, 0x00000020, 0x00000001,
+	0x00040017, 0x00000006, 0x00000004, 0x00000003, 0x0003001d, 0x00000007, 0x00000002, 0x0003001e,
+	0x00000008, 0x00000007, 0x00040020, 0x00000009, 0x00000002, 0x00000008, 0x0004003b, 0x00000009,
+	0x0000000a, 0x00000002, 0x0005001e, 0x0000000b, 0x00000003, 0x00000004, 0x00000004, 0x00040020,
+	0x0000000c, 0x00000009, 0x0000000b, 0x0004003b, 0x0000000c, 0x0000000d, 0x00000009, 0x00020013,
+	0x0000000e, 0x00030021, 0x0000000f, 0x0000000e, 0x0004002b, 0x00000001, 0x00000012, 0x3f800000,
+	0x0004002b, 0x00000005, 0x00000014, 0x00000001, 0x00040020, 0x00000015, 0x00000009, 0x00000004,
+	0x0004002b, 0x00000005, 0x00000018, 0x00000000, 0x00040020, 0x00000019, 0x00000009, 0x00000003,
+	0x00040020, 0x0000001c, 0x00000002, 0x00000002, 0x00050036, 0x0000000e, 0x00000010, 0x00000000,
+	0x0000000f, 0x000200f8, 0x00000011, 0x00070050, 0x00000002, 0x00000013, 0x00000012, 0x00000012,
+	0x00000012, 0x00000012, 0x00050041, 0x00000015, 0x00000016, 0x0000000d, 0x00000014, 0x0004003d,
+	0x00000004, 0x00000017, 0x00000016, 0x00050041, 0x00000019, 0x0000001a, 0x0000000d, 0x00000018,
+	0x0004003d, 0x00000003, 0x0000001b, 0x0000001a, 0x00060041, 0x0000001c, 0x0000001d, 0x0000000a,
+	0x00000018, 0x00000017, 0x00050091, 0x00000002, 0x0000001e, 0x0000001b, 0x00000013, 0x0003003e,
+	0x0000001d, 0x0000001e, 0x000100fd, 0x00010038, 0x07230203, 0x00010000, 0x00000000, 0x00000022,
+	0x00000000, 0x00020011, 0x00000001, 0x0003000e, 0x00000000, 0x00000001, 0x0005000f, 0x00000005,
+	0x00000013, 0x6e69616d, 0x00000000, 0x00060010, 0x00000013, 0x00000011, 0x00000001, 0x00000001,
+	0x00000001, 0x00050005, 0x00000007, 0x656a624f, 0x6c427463, 0x006b636f, 0x00050006, 0x00000007,
+	0x00000000, 0x65646f6d, 0x0000006c, 0x00040005, 0x00000009, 0x636f6c62, 0x0000006b, 0x00040005,
+	0x0000000b, 0x75736552, 0x0073746c, 0x00060006, 0x0000000b, 0x00000000, 0x69736f70, 0x6e6f6974,
+	0x00000073, 0x00040005, 0x0000000d, 0x75736572, 0x0073746c, 0x000a0005, 0x0000000e, 0x66696e55,
+	0x426d726f, 0x68636e65, 0x6b72616d, 0x68737550, 0x736e6f43, 0x746e6174, 0x00000073, 0x00050006,
+	0x0000000e, 0x00000000, 0x65646f6d, 0x0000006c, 0x00060006, 0x0000000e, 0x00000001, 0x656a626f,
+	0x6e497463, 0x00786564, 0x00060006, 0x0000000e, 0x00000002, 0x656a626f, 0x6f437463, 0x00746e75,
+	0x00040005, 0x00000010, 0x656a626f, 0x00007463, 0x00040005, 0x00000013, 0x6e69616d, 0x00000000,
+	0x00040048, 0x00000007, 0x00000000, 0x00000005, 0x00050048, 0x00000007, 0x00000000, 0x00000023,
+	0x00000000, 0x00050048, 0x00000007, 0x00000000, 0x00000007, 0x00000010, 0x00030047, 0x00000007,
+	0x00000002, 0x00040047, 0x00000009, 0x00000022, 0x00000000, 0x00040047, 0x00000009, 0x00000021,
+	0x00000000, 0x00040047, 0x0000000a, 0x00000006, 0x00000010, 0x00040048, 0x0000000b, 0x00000000,
+	0x00000019, 0x00050048, 0x0000000b, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000000b,
+	0x00000003, 0x00040047, 0x0000000d, 0x00000022, 0x00000000, 0x00040047, 0x0000000d, 0x00000021,
+	0x00000002, 0x00040048, 0x0000000e, 0x00000000, 0x00000005, 0x00050048, 0x0000000e, 0x00000000,
+	0x00000023, 0x00000000, 0x00050048, 0x0000000e, 0x00000000, 0x00000007, 0x00000010, 0x00050048,
+	0x0000000e, 0x00000001, 0x00000023, 0x00000040, 0x00050048, 0x0000000e, 0x00000002, 0x00000023,
+	0x00000044, 0x00030047, 0x0000000e, 0x00000002, 0x00030016, 0x00000001, 0x00000020, 0x00040017,
+	0x00000002, 0x00000001, 0x00000004, 0x00040018, 0x00000003, 0x00000002, 0x00000004, 0x00040015,
+	0x00000004, 0x00000020, 0x00000000, 0x00040015, 0x00000005, 0x00000020, 0x00000001, 0x00040017,
+	0x00000006, 0x00000004, 0x00000003, 0x0003001e, 0x00000007, 0x00000003, 0x00040020, 0x00000008,
+	0x00000002, 0x00000007, 0x0004003b, 0x00000008, 0x00000009, 0x00000002, 0x0003001d, 0x0000000a,
+	0x00000002, 0x0003001e, 0x0000000b, 0x0000000a, 0x00040020, 0x0000000c, 0x00000002, 0x0000000b,
+	0x0004003b, 0x0000000c, 0x0000000d, 0x00000002, 0x0005001e, 0x0000000e, 0x00000003, 0x00000004,
+	0x00000004, 0x00040020, 0x0000000f, 0x00000009, 0x0000000e, 0x0004003b, 0x0000000f, 0x00000010,
+	0x00000009, 0x00020013, 0x00000011, 0x00030021, 0x00000012, 0x00000011, 0x0004002b, 0x00000001,
+	0x00000015, 0x3f800000, 0x0004002b, 0x00000005, 0x00000017, 0x00000001, 0x00040020, 0x00000018,
+	0x00000009, 0x00000004, 0x0004002b, 0x00000005, 0x0000001b, 0x00000000, 0x00040020, 0x0000001c,
+	0x00000002, 0x00000003, 0x00040020, 0x0000001f, 0x00000002, 0x00000002, 0x00050036, 0x00000011,
+	0x00000013, 0x00000000, 0x00000012, 0x000200f8, 0x00000014, 0x00070050, 0x00000002, 0x00000016,
+	0x00000015, 0x00000015, 0x00000015, 0x00000015, 0x00050041, 0x00000018, 0x00000019, 0x00000010,
+	0x00000017, 0x0004003d, 0x00000004, 0x0000001a, 0x00000019, 0x00050041, 0x0000001c, 0x0000001d,
+	0x00000009, 0x0000001b, 0x0004003d, 0x00000003, 0x0000001e, 0x0000001d, 0x00060041, 0x0000001f,
+	0x00000020, 0x0000000d, 0x0000001b, 0x0000001a, 0x00050091, 0x00000002, 0x00000021, 0x0000001e,
+	0x00000016, 0x0003003e, 0x00000020, 0x00000021, 0x000100fd, 0x00010038, 0x07230203, 0x00010000,
+	0x00000000, 0x0000002b, 0x00000000, 0x00020011, 0x00000001, 0x0003000e, 0x00000000, 0x00000001,
+	0x0006000f, 0x00000005, 0x00000016, 0x6e69616d, 0x00000000, 0x00000008, 0x00060010, 0x00000016,
+	0x00000011, 0x00000040, 0x00000001, 0x00000001, 0x00080005, 0x00000008, 0x475f6c67, 0x61626f6c,
+	0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00040005, 0x0000000a, 0x656a624f, 0x00737463,
+	0x00050006, 0x0000000a, 0x00000000, 0x65646f6d, 0x0000736c, 0x00040005, 0x0000000c, 0x656a626f,
+	0x00737463, 0x00040005, 0x0000000e, 0x75736552, 0x0073746c, 0x00060006, 0x0000000e, 0x00000000,
+	0x69736f70, 0x6e6f6974, 0x00000073, 0x00040005, 0x00000010, 0x75736572, 0x0073746c, 0x000a0005,
+	0x00000011, 0x66696e55, 0x426d726f, 0x68636e65, 0x6b72616d, 0x68737550, 0x736e6f43, 0x746e6174,
+	0x00000073, 0x00050006, 0x00000011, 0x00000000, 0x65646f6d, 0x0000006c, 0x00060006, 0x00000011,
+	0x00000001, 0x656a626f, 0x6e497463, 0x00786564, 0x00060006, 0x00000011, 0x00000002, 0x656a626f,
+	0x6f437463, 0x00746e75, 0x00040005, 0x00000013, 0x656a626f, 0x00007463, 0x00040005, 0x00000016,
+	0x6e69616d, 0x00000000, 0x00040047, 0x00000008, 0x0000000b, 0x0000001c, 0x00040047, 0x00000009,
+	0x00000006, 0x00000040, 0x00040048, 0x0000000a, 0x00000000, 0x00000018, 0x00040048, 0x0000000a,
+	0x00000000, 0x00000005, 0x00050048, 0x0000000a, 0x00000000, 0x00000023, 0x00000000, 0x00050048,
+	0x0000000a, 0x00000000, 0x00000007, 0x00000010, 0x00030047, 0x0000000a, 0x00000003, 0x00040047,
+	0x0000000c, 0x00000022, 0x00000000, 0x00040047, 0x0000000c, 0x00000021, 0x00000001, 0x00040047,
+	0x0000000d, 0x00000006, 0x00000010, 0x00040048, 0x0000000e, 0x00000000, 0x00000019, 0x00050048,
+	0x0000000e, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000000e, 0x00000003, 0x00040047,
+	0x00000010, 0x00000022, 0x00000000, 0x00040047, 0x00000010, 0x00000021, 0x00000002, 0x00040048,
+	0x00000011, 0x00000000, 0x00000005, 0x00050048, 0x00000011, 0x00000000, 0x00000023, 0x00000000,
+	0x00050048, 0x00000011, 0x00000000, 0x00000007, 0x00000010, 0x00050048, 0x00000011, 0x00000001,
+	0x00000023, 0x00000040, 0x00050048, 0x00000011, 0x00000002, 0x00000023, 0x00000044, 0x00030047,
+	0x00000011, 0x00000002, 0x00030016, 0x00000001, 0x00000020, 0x00040017, 0x00000002, 0x00000001,
+	0x00000004, 0x00040018, 0x00000003, 0x00000002, 0x00000004, 0x00040015, 0x00000004, 0x00000020,
+	0x00000000, 0x00040015, 0x00000005, 0x00000020, 0x00000001, 0x00040017, 0x00000006, 0x00000004,
+	0x00000003, 0x00040020, 0x00000007, 0x00000001, 0x00000006, 0x0004003b, 0x00000007, 0x00000008,
+	0x00000001, 0x0003001d, 0x00000009, 0x00000003, 0x0003001e, 0x0000000a, 0x00000009, 0x00040020,
+	0x0000000b, 0x00000002, 0x0000000a, 0x0004003b, 0x0000000b, 0x0000000c, 0x00000002, 0x0003001d,
+	0x0000000d, 0x00000002, 0x0003001e, 0x0000000e, 0x0000000d, 0x00040020, 0x0000000f, 0x00000002,
+	0x0000000e, 0x0004003b, 0x0000000f, 0x00000010, 0x00000002, 0x0005001e, 0x00000011, 0x00000003,
+	0x00000004, 0x00000004, 0x00040020, 0x00000012, 0x00000009, 0x00000011, 0x0004003b, 0x00000012,
+	0x00000013, 0x00000009, 0x00020013, 0x00000014, 0x00030021, 0x00000015, 0x00000014, 0x0004002b,
+	0x00000001, 0x00000018, 0x3f800000, 0x0004002b, 0x00000005, 0x0000001e, 0x00000002, 0x00040020,
+	0x0000001f, 0x00000009, 0x00000004, 0x00020014, 0x00000022, 0x0004002b, 0x00000005, 0x00000024,
+	0x00000000, 0x00040020, 0x00000025, 0x00000002, 0x00000003, 0x00040020, 0x00000028, 0x00000002,
+	0x00000002, 0x00050036, 0x00000014, 0x00000016, 0x00000000, 0x00000015, 0x000200f8, 0x00000017,
+	0x00070050, 0x00000002, 0x00000019, 0x00000018, 0x00000018, 0x00000018, 0x00000018, 0x0004003d,
+	0x00000006, 0x0000001a, 0x00000008, 0x00050051, 0x00000004, 0x0000001b, 0x0000001a, 0x00000000,
+	0x00050041, 0x0000001f, 0x00000020, 0x00000013, 0x0000001e, 0x0004003d, 0x00000004, 0x00000021,
+	0x00000020, 0x000500ae, 0x00000022, 0x00000023, 0x0000001b, 0x00000021, 0x000300f7, 0x0000001c,
+	0x00000000, 0x000400fa, 0x00000023, 0x0000001d, 0x0000001c, 0x000200f8, 0x0000001d, 0x000100fd,
+	0x000200f8, 0x0000001c, 0x00060041, 0x00000025, 0x00000026, 0x0000000c, 0x00000024, 0x0000001b,
+	0x0004003d, 0x00000003, 0x00000027, 0x00000026, 0x00060041, 0x00000028, 0x00000029, 0x00000010,
+	0x00000024, 0x0000001b, 0x00050091, 0x00000002, 0x0000002a, 0x00000027, 0x00000019, 0x0003003e,
+	0x00000029, 0x0000002a, 0x000100fd, 0x00010038,
+};
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+struct ShaderPackEntry
+{
+	char name[32];
+	uint32_t offset;
+	uint32_t size;
+};
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+struct ShaderPackHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t entryCount;
+};
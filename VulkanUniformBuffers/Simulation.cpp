@@ -0,0 +1,137 @@
+#include "Simulation.h"
+#include <algorithm>
+#include <glm/glm.hpp>
+#include "Camera.h"
+
+
+Simulation::Simulation(std::shared_ptr<Camera> camera)
+	: pendingInput(),
+	running(false),
+	tickCount(0)
+{
+	this->camera = camera;
+
+	SimulationSnapshot& initialSnapshot = snapshots.getBack();
+	initialSnapshot.tick = 0;
+	initialSnapshot.tickTime = std::chrono::high_resolution_clock::now();
+	initialSnapshot.previousCamera = camera->getState();
+	initialSnapshot.currentCamera = camera->getState();
+	snapshots.publish();
+}
+
+Simulation::~Simulation()
+{
+	stop();
+}
+
+void Simulation::start()
+{
+	if (running)
+	{
+		return;
+	}
+
+	running = true;
+	thread = std::thread(&Simulation::run, this);
+}
+
+void Simulation::stop()
+{
+	running = false;
+
+	if (thread.joinable())
+	{
+		thread.join();
+	}
+}
+
+void Simulation::run()
+{
+	using namespace std::chrono;
+
+	high_resolution_clock::time_point nextTick = high_resolution_clock::now();
+
+	while (running)
+	{
+		int catchUpTicks = 0;
+
+		while (nextTick <= high_resolution_clock::now() && catchUpTicks < MAX_CATCH_UP_TICKS)
+		{
+			tick(nextTick);
+			nextTick += TICK_DURATION;
+			++catchUpTicks;
+		}
+
+		// After a long stall, drop the backlog instead of fast-forwarding through it.
+		if (catchUpTicks == MAX_CATCH_UP_TICKS)
+		{
+			nextTick = high_resolution_clock::now() + TICK_DURATION;
+		}
+
+		std::this_thread::sleep_until(nextTick);
+	}
+}
+
+void Simulation::tick(std::chrono::high_resolution_clock::time_point tickTime)
+{
+	float tickSec = std::chrono::duration<float>(TICK_DURATION).count();
+
+	CameraState previousCamera = camera->getState();
+	camera->update(takeInput(), tickSec);
+
+	++tickCount;
+	publish(tickTime, previousCamera);
+}
+
+InputState Simulation::takeInput()
+{
+	std::lock_guard<std::mutex> lock(inputMutex);
+
+	InputState inputState = pendingInput;
+	pendingInput.mouseXRel = 0;
+	pendingInput.mouseYRel = 0;
+
+	return inputState;
+}
+
+void Simulation::publish(std::chrono::high_resolution_clock::time_point tickTime, const CameraState& previousCamera)
+{
+	SimulationSnapshot& snapshot = snapshots.getBack();
+	snapshot.tick = tickCount;
+	snapshot.tickTime = tickTime;
+	snapshot.previousCamera = previousCamera;
+	snapshot.currentCamera = camera->getState();
+
+	snapshots.publish();
+}
+
+void Simulation::submitInput(const InputState& inputState)
+{
+	std::lock_guard<std::mutex> lock(inputMutex);
+
+	Sint32 mouseXRel = pendingInput.mouseXRel + inputState.mouseXRel;
+	Sint32 mouseYRel = pendingInput.mouseYRel + inputState.mouseYRel;
+
+	pendingInput = inputState;
+	pendingInput.mouseXRel = mouseXRel;
+	pendingInput.mouseYRel = mouseYRel;
+}
+
+// Rendering runs one tick behind the simulation and blends the last two published states, so motion stays
+// smooth when the frame rate and the tick rate differ.
+CameraState Simulation::getInterpolatedCameraState(std::chrono::high_resolution_clock::time_point renderTime)
+{
+	snapshots.update();
+	const SimulationSnapshot& snapshot = snapshots.getFront();
+
+	double elapsed = std::chrono::duration<double>(renderTime - snapshot.tickTime).count();
+	double tickSec = std::chrono::duration<double>(TICK_DURATION).count();
+	float alpha = static_cast<float>(std::min(std::max(elapsed / tickSec, 0.0), 1.0));
+
+	CameraState cameraState;
+	cameraState.position = glm::mix(snapshot.previousCamera.position, snapshot.currentCamera.position, alpha);
+	cameraState.orientation = glm::slerp(snapshot.previousCamera.orientation, snapshot.currentCamera.orientation,
+		alpha);
+
+	return cameraState;
+}
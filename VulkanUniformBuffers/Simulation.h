@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include "InputState.h"
+#include "CameraState.h"
+#include "SimulationSnapshot.h"
+#include "TripleBuffer.h"
+
+
+class Camera;
+
+
+class Simulation
+{
+private:
+	const std::chrono::microseconds TICK_DURATION = std::chrono::microseconds(1000000 / 120);
+	const int MAX_CATCH_UP_TICKS = 8;
+
+	std::shared_ptr<Camera> camera;
+	TripleBuffer<SimulationSnapshot> snapshots;
+	std::mutex inputMutex;
+	InputState pendingInput;
+	std::atomic<bool> running;
+	std::thread thread;
+	uint64_t tickCount;
+
+	void run();
+	void tick(std::chrono::high_resolution_clock::time_point tickTime);
+	InputState takeInput();
+	void publish(std::chrono::high_resolution_clock::time_point tickTime, const CameraState& previousCamera);
+
+public:
+	Simulation(std::shared_ptr<Camera> camera);
+	~Simulation();
+
+	void start();
+	void stop();
+	void submitInput(const InputState& inputState);
+	CameraState getInterpolatedCameraState(std::chrono::high_resolution_clock::time_point renderTime);
+};
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include "CameraState.h"
+
+
+struct SimulationSnapshot
+{
+	uint64_t tick;
+	std::chrono::high_resolution_clock::time_point tickTime;
+	CameraState previousCamera;
+	CameraState currentCamera;
+};
@@ -0,0 +1,37 @@
+#include "StatsPrinter.h"
+#include <iostream>
+
+
+void printStats(const std::string& label, const FrameStats& stats)
+{
+	std::cout << label
+		<< ": avg: " << stats.averageMs << " ms"
+		<< ", p50: " << stats.p50Ms << " ms"
+		<< ", p95: " << stats.p95Ms << " ms"
+		<< ", p99: " << stats.p99Ms << " ms" << std::endl;
+}
+
+void printFrameStats(const std::string& label, const FrameStats& frameStats)
+{
+	std::cout << label
+		<< ", frames: " << frameStats.frameCount
+		<< ", avg: " << frameStats.averageMs << " ms"
+		<< ", min: " << frameStats.minMs << " ms"
+		<< ", p50: " << frameStats.p50Ms << " ms"
+		<< ", p95: " << frameStats.p95Ms << " ms"
+		<< ", p99: " << frameStats.p99Ms << " ms"
+		<< ", max: " << frameStats.maxMs << " ms" << std::endl;
+}
+
+void printGpuStats(const std::vector<GpuRegionStats>& gpuStats)
+{
+	for (const GpuRegionStats& region : gpuStats)
+	{
+		printStats("  gpu " + region.name, region.stats);
+	}
+}
+
+void printRecordingStats(const FrameStats& recordingStats)
+{
+	printStats("  cpu command recording", recordingStats);
+}
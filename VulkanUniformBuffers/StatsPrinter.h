@@ -0,0 +1,12 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "FrameStats.h"
+#include "GpuRegionStats.h"
+
+
+void printStats(const std::string& label, const FrameStats& stats);
+void printFrameStats(const std::string& label, const FrameStats& frameStats);
+void printGpuStats(const std::vector<GpuRegionStats>& gpuStats);
+void printRecordingStats(const FrameStats& recordingStats);
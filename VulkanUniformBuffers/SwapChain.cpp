@@ -4,27 +4,29 @@
 #include "PhysicalDevice.h"
 #include "Device.h"
 #include "VulkanSurface.h"
+#include "MemoryAllocator.h"
 #include <vulkan.h>
 #include <memory>
+#include <algorithm>
 #include <SDL_vulkan.h>
 #include <SDL.h>
 #include <glm/glm.hpp>
 
 
 SwapChain::SwapChain(SDL_Window* sdlWindow, std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device, 
-	std::shared_ptr<VulkanSurface> vulkanSurface)
+	std::shared_ptr<VulkanSurface> vulkanSurface, PresentPolicy presentPolicy, VkSwapchainKHR oldSwapChain)
 {
 	this->device = device;
 
 	SwapChainSupportDetails supportDetails = physicalDevice->getSwapChainSupportDetails();
 	VkSurfaceFormatKHR surfaceFormat = chooseSwapSurfaceFormat(supportDetails.formats);
-	VkPresentModeKHR presentMode = chooseSwapPresentMode(supportDetails.presentModes);
+	VkPresentModeKHR presentMode = chooseSwapPresentMode(supportDetails.presentModes, presentPolicy);
 	VkExtent2D extent = chooseSwapExtent(sdlWindow, supportDetails.capabilities);
 
-	uint32_t imageCount = calculateImageCount(&supportDetails);
+	uint32_t imageCount = calculateImageCount(&supportDetails, presentMode);
 
 	VkSwapchainCreateInfoKHR swapChainCreateInfo = createSwapChainCreateInfo(physicalDevice, vulkanSurface, imageCount,
-		surfaceFormat, extent, supportDetails, presentMode);
+		surfaceFormat, extent, supportDetails, presentMode, oldSwapChain);
 
 	VkResult result = createSwapChain(device, &swapChainCreateInfo);
 	throwIfCreationFailed(result);
@@ -33,10 +35,27 @@ SwapChain::SwapChain(SDL_Window* sdlWindow, std::shared_ptr<PhysicalDevice> phys
 
 	vkSwapChainImageFormat = surfaceFormat.format;
 	vkSwapChainExtent = extent;
+	vkPresentMode = presentMode;
 
 	createSwapChainImageViews(device);
 }
 
+// Offscreen variant for headless rendering: plain color images cycled like swapchain images, nothing is presented.
+SwapChain::SwapChain(std::shared_ptr<Device> device, std::shared_ptr<MemoryAllocator> memoryAllocator,
+	VkExtent2D extent, uint32_t imageCount)
+{
+	this->device = device;
+	this->memoryAllocator = memoryAllocator;
+
+	vkSwapChain = VK_NULL_HANDLE;
+	vkSwapChainImageFormat = OFFSCREEN_FORMAT;
+	vkSwapChainExtent = extent;
+	vkPresentMode = VK_PRESENT_MODE_IMMEDIATE_KHR;
+
+	createOffscreenImages(imageCount);
+	createSwapChainImageViews(device);
+}
+
 SwapChain::~SwapChain()
 {
 	for (VkImageView swapchainImageView : vkSwapChainImageViews)
@@ -44,14 +63,78 @@ SwapChain::~SwapChain()
 		vkDestroyImageView(device->getHandle(), swapchainImageView, nullptr);
 	}
 
-	vkDestroySwapchainKHR(device->getHandle(), vkSwapChain, nullptr);
+	if (isOffscreen())
+	{
+		destroyOffscreenImages();
+	}
+	else
+	{
+		vkDestroySwapchainKHR(device->getHandle(), vkSwapChain, nullptr);
+	}
 }
 
+void SwapChain::createOffscreenImages(uint32_t imageCount)
+{
+	VkImageCreateInfo createInfo = {};
+	createInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+	createInfo.imageType = VK_IMAGE_TYPE_2D;
+	createInfo.format = OFFSCREEN_FORMAT;
+	createInfo.extent = { vkSwapChainExtent.width, vkSwapChainExtent.height, 1 };
+	createInfo.mipLevels = 1;
+	createInfo.arrayLayers = 1;
+	createInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+	createInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+	createInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+	createInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	createInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+	vkSwapChainImages.resize(imageCount);
+	offscreenAllocations.resize(imageCount);
+
+	for (uint32_t i = 0; i < imageCount; ++i)
+	{
+		VkResult result = vkCreateImage(device->getHandle(), &createInfo, nullptr, &vkSwapChainImages[i]);
+		throwIfCreateImageFailed(result);
+
+		offscreenAllocations[i] = memoryAllocator->allocateImageMemory(vkSwapChainImages[i],
+			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+	}
+}
 
-uint32_t SwapChain::calculateImageCount(SwapChainSupportDetails* supportDetails) const
+void SwapChain::throwIfCreateImageFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create offscreen image.");
+	}
+}
+
+void SwapChain::destroyOffscreenImages()
+{
+	for (size_t i = 0; i < vkSwapChainImages.size(); ++i)
+	{
+		vkDestroyImage(device->getHandle(), vkSwapChainImages[i], nullptr);
+		memoryAllocator->free(offscreenAllocations[i]);
+	}
+}
+
+
+uint32_t SwapChain::calculateImageCount(SwapChainSupportDetails* supportDetails, VkPresentModeKHR presentMode) const
 {
 	uint32_t imageCount = supportDetails->capabilities.minImageCount + 1;
 
+	switch (presentMode)
+	{
+	case VK_PRESENT_MODE_MAILBOX_KHR:
+		imageCount = std::max(imageCount, 3u);
+		break;
+	case VK_PRESENT_MODE_IMMEDIATE_KHR:
+		imageCount = std::max(supportDetails->capabilities.minImageCount, 2u);
+		break;
+	default:
+		break;
+	}
+
 	if (supportDetails->capabilities.maxImageCount > 0 &&
 		imageCount > supportDetails->capabilities.maxImageCount)
 	{
@@ -67,11 +150,41 @@ VkSurfaceFormatKHR SwapChain::chooseSwapSurfaceFormat(const std::vector<VkSurfac
 	return formats[0];
 }
 
-VkPresentModeKHR SwapChain::chooseSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes)
+VkPresentModeKHR SwapChain::chooseSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes,
+	PresentPolicy presentPolicy)
 {
+	for (VkPresentModeKHR presentMode : listPreferredPresentModes(presentPolicy))
+	{
+		if (isPresentModeSupported(presentModes, presentMode))
+		{
+			return presentMode;
+		}
+	}
+
 	return VK_PRESENT_MODE_FIFO_KHR;
 }
 
+std::vector<VkPresentModeKHR> SwapChain::listPreferredPresentModes(PresentPolicy presentPolicy) const
+{
+	switch (presentPolicy)
+	{
+	case PresentPolicy::Mailbox:
+		return { VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_FIFO_KHR };
+	case PresentPolicy::Immediate:
+		return { VK_PRESENT_MODE_IMMEDIATE_KHR, VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_FIFO_KHR };
+	case PresentPolicy::FifoRelaxed:
+		return { VK_PRESENT_MODE_FIFO_RELAXED_KHR, VK_PRESENT_MODE_FIFO_KHR };
+	default:
+		return { VK_PRESENT_MODE_FIFO_KHR };
+	}
+}
+
+bool SwapChain::isPresentModeSupported(const std::vector<VkPresentModeKHR>& presentModes,
+	VkPresentModeKHR presentMode) const
+{
+	return std::find(presentModes.begin(), presentModes.end(), presentMode) != presentModes.end();
+}
+
 VkExtent2D SwapChain::chooseSwapExtent(SDL_Window* sdlWindow, const VkSurfaceCapabilitiesKHR& capabilities)
 {
 	VkExtent2D extent;
@@ -80,8 +193,8 @@ VkExtent2D SwapChain::chooseSwapExtent(SDL_Window* sdlWindow, const VkSurfaceCap
 	{
 		int width, height;
 		SDL_Vulkan_GetDrawableSize(sdlWindow, &width, &height);
-		height = clampHeight(height, &capabilities);
-		width = clampWidth(width, &capabilities);
+		extent.height = clampHeight(height, &capabilities);
+		extent.width = clampWidth(width, &capabilities);
 	}
 	else
 	{
@@ -171,7 +284,8 @@ VkFormat SwapChain::getSwapChainImageFormat()
 
 VkSwapchainCreateInfoKHR SwapChain::createSwapChainCreateInfo(std::shared_ptr<PhysicalDevice> physicalDevice,
 	std::shared_ptr<VulkanSurface> vulkanSurface, uint32_t imageCount, VkSurfaceFormatKHR surfaceFormat,
-	VkExtent2D extent, SwapChainSupportDetails supportDetails, VkPresentModeKHR presentMode)
+	VkExtent2D extent, SwapChainSupportDetails supportDetails, VkPresentModeKHR presentMode,
+	VkSwapchainKHR oldSwapChain)
 {
 	VkSwapchainCreateInfoKHR swapChainCreateInfo = {};
 	swapChainCreateInfo.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
@@ -203,7 +317,7 @@ VkSwapchainCreateInfoKHR SwapChain::createSwapChainCreateInfo(std::shared_ptr<Ph
 	swapChainCreateInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
 	swapChainCreateInfo.presentMode = presentMode;
 	swapChainCreateInfo.clipped = VK_TRUE;
-	swapChainCreateInfo.oldSwapchain = VK_NULL_HANDLE;
+	swapChainCreateInfo.oldSwapchain = oldSwapChain;
 
 	return swapChainCreateInfo;
 }
@@ -227,4 +341,19 @@ void SwapChain::initSwapChainImages(std::shared_ptr<Device> device)
 	vkGetSwapchainImagesKHR(device->getHandle(), vkSwapChain, &finalImageCount, nullptr);
 	vkSwapChainImages.resize(finalImageCount);
 	vkGetSwapchainImagesKHR(device->getHandle(), vkSwapChain, &finalImageCount, vkSwapChainImages.data());
+}
+
+VkPresentModeKHR SwapChain::getPresentMode() const
+{
+	return vkPresentMode;
+}
+
+VkImageLayout SwapChain::getPresentLayout() const
+{
+	return isOffscreen() ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+}
+
+bool SwapChain::isOffscreen() const
+{
+	return vkSwapChain == VK_NULL_HANDLE;
 }
\ No newline at end of file
@@ -3,11 +3,14 @@
 #include <memory>
 #include <vector>
 #include <vulkan.h>
+#include "PresentPolicy.h"
+#include "MemoryAllocation.h"
 
 
 class PhysicalDevice;
 class Device;
 class VulkanSurface;
+class MemoryAllocator;
 struct SDL_Window;
 struct SwapChainSupportDetails;
 
@@ -15,16 +18,23 @@ struct SwapChainSupportDetails;
 class SwapChain
 {
 private:
+	const VkFormat OFFSCREEN_FORMAT = VK_FORMAT_R8G8B8A8_UNORM;
+
 	std::shared_ptr<Device> device;
+	std::shared_ptr<MemoryAllocator> memoryAllocator;
+	std::vector<MemoryAllocation> offscreenAllocations;
 
 	VkSwapchainKHR vkSwapChain;
 	std::vector<VkImage> vkSwapChainImages;
 	std::vector<VkImageView> vkSwapChainImageViews;
 	VkFormat vkSwapChainImageFormat;
 	VkExtent2D vkSwapChainExtent;
+	VkPresentModeKHR vkPresentMode;
 
 	VkSurfaceFormatKHR chooseSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& formats);
-	VkPresentModeKHR chooseSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes);
+	VkPresentModeKHR chooseSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes, PresentPolicy presentPolicy);
+	std::vector<VkPresentModeKHR> listPreferredPresentModes(PresentPolicy presentPolicy) const;
+	bool isPresentModeSupported(const std::vector<VkPresentModeKHR>& presentModes, VkPresentModeKHR presentMode) const;
 	VkExtent2D chooseSwapExtent(SDL_Window* sdlWindow, const VkSurfaceCapabilitiesKHR& capabilities);
 	int clampHeight(int height, const VkSurfaceCapabilitiesKHR* capabilities);
 	int clampWidth(int width, const VkSurfaceCapabilitiesKHR* capabilities);
@@ -32,19 +42,27 @@ private:
 	VkResult createImageView(std::shared_ptr<Device> device, VkImageViewCreateInfo* createInfo,
 		VkImageView* imageView);
 	void throwIfCreateImageViewFailed(VkResult result);
-	uint32_t calculateImageCount(SwapChainSupportDetails* supportDetails) const;
+	uint32_t calculateImageCount(SwapChainSupportDetails* supportDetails, VkPresentModeKHR presentMode) const;
 
 	VkSwapchainCreateInfoKHR createSwapChainCreateInfo(std::shared_ptr<PhysicalDevice> physicalDevice,
 		std::shared_ptr<VulkanSurface> vulkanSurface, uint32_t imageCount, VkSurfaceFormatKHR surfaceFormat,
-		VkExtent2D extent, SwapChainSupportDetails supportDetails, VkPresentModeKHR presentMode);
+		VkExtent2D extent, SwapChainSupportDetails supportDetails, VkPresentModeKHR presentMode,
+		VkSwapchainKHR oldSwapChain);
 
 	VkResult createSwapChain(std::shared_ptr<Device> device, VkSwapchainCreateInfoKHR* swapChainCreateInfo);
 	void throwIfCreationFailed(VkResult result) const;
 	void initSwapChainImages(std::shared_ptr<Device> device);
+	void createOffscreenImages(uint32_t imageCount);
+	void throwIfCreateImageFailed(VkResult result) const;
+	void destroyOffscreenImages();
 
 public:
 	SwapChain(SDL_Window* sdlWindow, std::shared_ptr<PhysicalDevice> physiclaDevice, std::shared_ptr<Device> device,
-		std::shared_ptr<VulkanSurface> vulkanSurface);
+		std::shared_ptr<VulkanSurface> vulkanSurface, PresentPolicy presentPolicy,
+		VkSwapchainKHR oldSwapChain = VK_NULL_HANDLE);
+
+	SwapChain(std::shared_ptr<Device> device, std::shared_ptr<MemoryAllocator> memoryAllocator, VkExtent2D extent,
+		uint32_t imageCount);
 
 	~SwapChain();
 
@@ -53,4 +71,7 @@ public:
 	std::vector<VkImage>* initSwapChainImages();
 	VkExtent2D getSwapChainExtent();
 	VkFormat getSwapChainImageFormat();
+	VkPresentModeKHR getPresentMode() const;
+	VkImageLayout getPresentLayout() const;
+	bool isOffscreen() const;
 };
\ No newline at end of file
@@ -0,0 +1,219 @@
+#include "TaskGraph.h"
+#include <thread>
+#include <algorithm>
+#include <stdexcept>
+
+
+TaskGraph::TaskGraph()
+	: finishedCount(0),
+	wallTimeMs(0.0)
+{
+}
+
+void TaskGraph::addTask(const std::string& name, std::function<void()> function,
+	const std::vector<std::string>& dependencies)
+{
+	TaskGraphNode node = {};
+	node.name = name;
+	node.function = function;
+
+	for (const std::string& dependency : dependencies)
+	{
+		size_t dependencyIndex = findNode(dependency);
+		throwIfUnknownNode(dependencyIndex);
+
+		node.dependencies.push_back(dependencyIndex);
+		nodes[dependencyIndex].dependents.push_back(nodes.size());
+	}
+
+	nodes.push_back(node);
+}
+
+void TaskGraph::run(uint32_t workerCount)
+{
+	timings.assign(nodes.size(), TaskTiming{});
+	readyNodes.clear();
+	finishedCount = 0;
+	failure = nullptr;
+
+	for (size_t i = 0; i < nodes.size(); ++i)
+	{
+		nodes[i].pendingDependencyCount = nodes[i].dependencies.size();
+
+		if (nodes[i].pendingDependencyCount == 0)
+		{
+			readyNodes.push_back(i);
+		}
+	}
+
+	startTime = std::chrono::high_resolution_clock::now();
+
+	std::vector<std::thread> workers;
+
+	for (uint32_t i = 1; i < std::max(workerCount, 1u); ++i)
+	{
+		workers.emplace_back(&TaskGraph::runWorker, this, i);
+	}
+
+	runWorker(0);
+
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+
+	wallTimeMs = getElapsedMs();
+
+	if (failure)
+	{
+		std::rethrow_exception(failure);
+	}
+
+	markCriticalPath();
+}
+
+void TaskGraph::runWorker(uint32_t workerIndex)
+{
+	std::unique_lock<std::mutex> lock(mutex);
+
+	while (true)
+	{
+		condition.wait(lock, [this] { return !readyNodes.empty() || isDone(); });
+
+		if (isDone())
+		{
+			return;
+		}
+
+		size_t nodeIndex = readyNodes.front();
+		readyNodes.pop_front();
+		lock.unlock();
+
+		TaskTiming& timing = timings[nodeIndex];
+		timing.name = nodes[nodeIndex].name;
+		timing.workerIndex = workerIndex;
+		timing.startMs = getElapsedMs();
+
+		try
+		{
+			nodes[nodeIndex].function();
+		}
+		catch (...)
+		{
+			lock.lock();
+			failure = std::current_exception();
+			condition.notify_all();
+			return;
+		}
+
+		timing.endMs = getElapsedMs();
+
+		lock.lock();
+		finishNode(nodeIndex);
+	}
+}
+
+bool TaskGraph::isDone() const
+{
+	return failure || finishedCount == nodes.size();
+}
+
+double TaskGraph::getElapsedMs() const
+{
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - startTime;
+	return elapsed.count();
+}
+
+void TaskGraph::finishNode(size_t nodeIndex)
+{
+	++finishedCount;
+
+	for (size_t dependent : nodes[nodeIndex].dependents)
+	{
+		if (--nodes[dependent].pendingDependencyCount == 0)
+		{
+			readyNodes.push_back(dependent);
+		}
+	}
+
+	condition.notify_all();
+}
+
+void TaskGraph::markCriticalPath()
+{
+	if (nodes.empty())
+	{
+		return;
+	}
+
+	size_t nodeIndex = 0;
+
+	for (size_t i = 1; i < nodes.size(); ++i)
+	{
+		if (timings[i].endMs > timings[nodeIndex].endMs)
+		{
+			nodeIndex = i;
+		}
+	}
+
+	while (true)
+	{
+		timings[nodeIndex].onCriticalPath = true;
+
+		const std::vector<size_t>& dependencies = nodes[nodeIndex].dependencies;
+
+		if (dependencies.empty())
+		{
+			break;
+		}
+
+		nodeIndex = *std::max_element(dependencies.begin(), dependencies.end(),
+			[this](size_t a, size_t b) { return timings[a].endMs < timings[b].endMs; });
+	}
+}
+
+size_t TaskGraph::findNode(const std::string& name) const
+{
+	for (size_t i = 0; i < nodes.size(); ++i)
+	{
+		if (nodes[i].name == name)
+		{
+			return i;
+		}
+	}
+
+	return nodes.size();
+}
+
+void TaskGraph::throwIfUnknownNode(size_t nodeIndex) const
+{
+	if (nodeIndex == nodes.size())
+	{
+		throw std::runtime_error("Unknown task dependency.");
+	}
+}
+
+const std::vector<TaskTiming>& TaskGraph::getTimings() const
+{
+	return timings;
+}
+
+double TaskGraph::getWallTimeMs() const
+{
+	return wallTimeMs;
+}
+
+double TaskGraph::getCriticalPathMs() const
+{
+	double criticalPathMs = 0.0;
+
+	for (const TaskTiming& timing : timings)
+	{
+		if (timing.onCriticalPath)
+		{
+			criticalPathMs += timing.endMs - timing.startMs;
+		}
+	}
+
+	return criticalPathMs;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <chrono>
+#include "TaskTiming.h"
+
+
+struct TaskGraphNode
+{
+	std::string name;
+	std::function<void()> function;
+	std::vector<size_t> dependencies;
+	std::vector<size_t> dependents;
+	size_t pendingDependencyCount;
+};
+
+
+class TaskGraph
+{
+private:
+	std::vector<TaskGraphNode> nodes;
+	std::vector<TaskTiming> timings;
+	std::deque<size_t> readyNodes;
+	size_t finishedCount;
+	std::exception_ptr failure;
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::chrono::high_resolution_clock::time_point startTime;
+	double wallTimeMs;
+
+	void runWorker(uint32_t workerIndex);
+	bool isDone() const;
+	double getElapsedMs() const;
+	void finishNode(size_t nodeIndex);
+	void markCriticalPath();
+	size_t findNode(const std::string& name) const;
+	void throwIfUnknownNode(size_t nodeIndex) const;
+
+public:
+	TaskGraph();
+
+	void addTask(const std::string& name, std::function<void()> function,
+		const std::vector<std::string>& dependencies = {});
+
+	void run(uint32_t workerCount);
+	const std::vector<TaskTiming>& getTimings() const;
+	double getWallTimeMs() const;
+	double getCriticalPathMs() const;
+};
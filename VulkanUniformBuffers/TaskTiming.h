@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+
+
+struct TaskTiming
+{
+	std::string name;
+	uint32_t workerIndex;
+	double startMs;
+	double endMs;
+	bool onCriticalPath;
+};
@@ -0,0 +1,102 @@
+#include "TimelineSemaphore.h"
+#include "Device.h"
+#include <stdexcept>
+
+
+TimelineSemaphore::TimelineSemaphore(std::shared_ptr<Device> device, uint64_t initialValue)
+{
+	this->device = device;
+
+	loadFunctions();
+
+	VkSemaphoreTypeCreateInfoKHR typeCreateInfo = {};
+	typeCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+	typeCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+	typeCreateInfo.initialValue = initialValue;
+
+	VkSemaphoreCreateInfo createInfo = {};
+	createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+	createInfo.pNext = &typeCreateInfo;
+
+	VkResult result = vkCreateSemaphore(device->getHandle(), &createInfo, nullptr, &vkSemaphore);
+	throwIfCreationFailed(result);
+}
+
+TimelineSemaphore::~TimelineSemaphore()
+{
+	vkDestroySemaphore(device->getHandle(), vkSemaphore, nullptr);
+}
+
+void TimelineSemaphore::loadFunctions()
+{
+	PFN_vkVoidFunction function = vkGetDeviceProcAddr(device->getHandle(), "vkWaitSemaphoresKHR");
+	throwIfFunctionNotFound(function);
+	waitSemaphores = reinterpret_cast<PFN_vkWaitSemaphoresKHR>(function);
+
+	function = vkGetDeviceProcAddr(device->getHandle(), "vkGetSemaphoreCounterValueKHR");
+	throwIfFunctionNotFound(function);
+	getSemaphoreCounterValue = reinterpret_cast<PFN_vkGetSemaphoreCounterValueKHR>(function);
+}
+
+void TimelineSemaphore::wait(uint64_t value) const
+{
+	VkSemaphoreWaitInfoKHR waitInfo = {};
+	waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+	waitInfo.semaphoreCount = 1;
+	waitInfo.pSemaphores = &vkSemaphore;
+	waitInfo.pValues = &value;
+
+	VkResult result = waitSemaphores(device->getHandle(), &waitInfo, UINT64_MAX);
+	throwIfWaitFailed(result);
+}
+
+bool TimelineSemaphore::isReached(uint64_t value) const
+{
+	return getCompletedValue() >= value;
+}
+
+uint64_t TimelineSemaphore::getCompletedValue() const
+{
+	uint64_t value;
+	VkResult result = getSemaphoreCounterValue(device->getHandle(), vkSemaphore, &value);
+	throwIfGetCounterValueFailed(result);
+
+	return value;
+}
+
+void TimelineSemaphore::throwIfFunctionNotFound(PFN_vkVoidFunction function) const
+{
+	if (function == nullptr)
+	{
+		throw std::runtime_error("Failed to load timeline semaphore functions.");
+	}
+}
+
+void TimelineSemaphore::throwIfCreationFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create timeline semaphore.");
+	}
+}
+
+void TimelineSemaphore::throwIfWaitFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to wait for timeline semaphore.");
+	}
+}
+
+void TimelineSemaphore::throwIfGetCounterValueFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to get timeline semaphore value.");
+	}
+}
+
+VkSemaphore TimelineSemaphore::getHandle() const
+{
+	return vkSemaphore;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <vulkan.h>
+#include <memory>
+
+
+class Device;
+
+
+class TimelineSemaphore
+{
+private:
+	std::shared_ptr<Device> device;
+	VkSemaphore vkSemaphore;
+	PFN_vkWaitSemaphoresKHR waitSemaphores;
+	PFN_vkGetSemaphoreCounterValueKHR getSemaphoreCounterValue;
+
+	void loadFunctions();
+	void throwIfFunctionNotFound(PFN_vkVoidFunction function) const;
+	void throwIfCreationFailed(VkResult result) const;
+	void throwIfWaitFailed(VkResult result) const;
+	void throwIfGetCounterValueFailed(VkResult result) const;
+
+public:
+	TimelineSemaphore(std::shared_ptr<Device> device, uint64_t initialValue);
+	~TimelineSemaphore();
+
+	void wait(uint64_t value) const;
+	bool isReached(uint64_t value) const;
+	uint64_t getCompletedValue() const;
+	VkSemaphore getHandle() const;
+};
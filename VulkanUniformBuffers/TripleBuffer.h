@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+
+// Single-producer, single-consumer hand-off of the latest value. The writer fills the back slot and swaps it
+// with the shared middle slot; the reader swaps the middle slot into the front only when it holds new data.
+template <typename T>
+class TripleBuffer
+{
+private:
+	static const uint8_t INDEX_MASK = 0x3;
+	static const uint8_t DIRTY_BIT = 0x4;
+
+	T slots[3];
+	std::atomic<uint8_t> middle;
+	uint8_t back;
+	uint8_t front;
+
+public:
+	TripleBuffer()
+		: slots(),
+		middle(1),
+		back(0),
+		front(2)
+	{
+	}
+
+	T& getBack()
+	{
+		return slots[back];
+	}
+
+	void publish()
+	{
+		uint8_t published = static_cast<uint8_t>(back | DIRTY_BIT);
+		back = middle.exchange(published, std::memory_order_acq_rel) & INDEX_MASK;
+	}
+
+	bool update()
+	{
+		if ((middle.load(std::memory_order_acquire) & DIRTY_BIT) == 0)
+		{
+			return false;
+		}
+
+		front = middle.exchange(front, std::memory_order_acq_rel) & INDEX_MASK;
+		return true;
+	}
+
+	const T& getFront() const
+	{
+		return slots[front];
+	}
+};
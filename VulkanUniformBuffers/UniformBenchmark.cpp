@@ -0,0 +1,565 @@
+#include "UniformBenchmark.h"
+#include "PhysicalDevice.h"
+#include "Device.h"
+#include "CommandPool.h"
+#include "UniformRingBuffer.h"
+#include "UniformBenchmarkPipeline.h"
+#include "UniformBenchmarkPushConstants.h"
+#include "FrameTimer.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <chrono>
+#include <cstring>
+#include <cstddef>
+#include <stdexcept>
+
+
+UniformBenchmark::UniformBenchmark(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
+	std::shared_ptr<MemoryAllocator> memoryAllocator, std::shared_ptr<PipelineCache> pipelineCache,
+	std::shared_ptr<ShaderPack> shaderPack)
+	: Buffer(physicalDevice, device, memoryAllocator)
+{
+	VkDeviceSize alignment = physicalDevice->getProperties().limits.minUniformBufferOffsetAlignment;
+	objectStride = (sizeof(glm::mat4) + alignment - 1) / alignment * alignment;
+
+	benchmarkPipeline = std::make_shared<UniformBenchmarkPipeline>(device, pipelineCache, shaderPack);
+	commandPool = std::make_shared<CommandPool>(physicalDevice, device);
+	createCommandBuffer();
+	createFence();
+	createDescriptorPool();
+}
+
+UniformBenchmark::~UniformBenchmark()
+{
+	vkDestroyDescriptorPool(device->getHandle(), vkDescriptorPool, nullptr);
+	vkDestroyFence(device->getHandle(), vkFence, nullptr);
+	vkFreeCommandBuffers(device->getHandle(), commandPool->getHandle(), 1, &vkCommandBuffer);
+}
+
+std::vector<UniformBenchmarkResult> UniformBenchmark::runAll(const std::vector<uint32_t>& objectCounts,
+	uint32_t frameCount)
+{
+	const UniformUpdateStrategy strategies[] = {
+		UniformUpdateStrategy::MapUnmap,
+		UniformUpdateStrategy::PersistentMapping,
+		UniformUpdateStrategy::DynamicRing,
+		UniformUpdateStrategy::PushConstants,
+		UniformUpdateStrategy::StagingCopy,
+		UniformUpdateStrategy::StorageBuffer
+	};
+
+	std::vector<UniformBenchmarkResult> results;
+
+	for (UniformUpdateStrategy strategy : strategies)
+	{
+		for (uint32_t objectCount : objectCounts)
+		{
+			results.push_back(run(strategy, objectCount, frameCount));
+		}
+	}
+
+	return results;
+}
+
+// Every strategy ends in a compute dispatch that reads its transforms, so the update cost is measured together with
+// the shader access it enables. Recording and the GPU consume are timed separately.
+UniformBenchmarkResult UniformBenchmark::run(UniformUpdateStrategy strategy, uint32_t objectCount,
+	uint32_t frameCount)
+{
+	using namespace std::chrono;
+
+	fillTransforms(objectCount);
+	createResources(strategy, objectCount);
+
+	FrameTimer recordTimer;
+	FrameTimer consumeTimer;
+
+	for (uint32_t frame = 0; frame < WARM_UP_FRAME_COUNT + frameCount; ++frame)
+	{
+		high_resolution_clock::time_point recordStart = high_resolution_clock::now();
+
+		beginCommandBuffer();
+		updateObjects(strategy, objectCount);
+		vkEndCommandBuffer(vkCommandBuffer);
+
+		high_resolution_clock::time_point recordEnd = high_resolution_clock::now();
+
+		submitAndWait();
+
+		high_resolution_clock::time_point consumeEnd = high_resolution_clock::now();
+
+		if (frame >= WARM_UP_FRAME_COUNT)
+		{
+			recordTimer.addSample(duration<double, std::milli>(recordEnd - recordStart).count());
+			consumeTimer.addSample(duration<double, std::milli>(consumeEnd - recordEnd).count());
+		}
+	}
+
+	destroyResources(strategy);
+
+	UniformBenchmarkResult result = {};
+	result.strategy = strategy;
+	result.objectCount = objectCount;
+	result.recordStats = recordTimer.getStats();
+	result.consumeStats = consumeTimer.getStats();
+
+	return result;
+}
+
+// Uniform strategies lay objects out at the dynamic offset alignment and bind one at a time; the storage strategies
+// pack the array and let one dispatch index it by invocation.
+void UniformBenchmark::createResources(UniformUpdateStrategy strategy, uint32_t objectCount)
+{
+	VkDeviceSize size = sizeof(glm::mat4) * objectCount;
+	VkDeviceSize stridedSize = objectStride * objectCount;
+
+	createBuffer(sizeof(glm::vec4) * objectCount, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &resultBuffer, &resultAllocation);
+	allocateDescriptorSet();
+	writeDescriptor(2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, resultBuffer, sizeof(glm::vec4) * objectCount);
+
+	switch (strategy)
+	{
+	case UniformUpdateStrategy::MapUnmap:
+		createMapUnmapBuffer(stridedSize);
+		writeDescriptor(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, mappedBuffer, sizeof(glm::mat4));
+		break;
+	case UniformUpdateStrategy::PersistentMapping:
+		createHostVisibleBuffer(stridedSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, &hostBuffer, &hostAllocation);
+		writeDescriptor(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, hostBuffer, sizeof(glm::mat4));
+		break;
+	case UniformUpdateStrategy::DynamicRing:
+		createRingBuffer(objectCount);
+		writeDescriptor(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, ringBuffer->getHandle(), sizeof(glm::mat4));
+		break;
+	case UniformUpdateStrategy::StagingCopy:
+		createHostVisibleBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, &hostBuffer, &hostAllocation);
+		createBuffer(size, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &deviceBuffer, &deviceAllocation);
+		writeDescriptor(1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, deviceBuffer, size);
+		break;
+	case UniformUpdateStrategy::StorageBuffer:
+		createHostVisibleBuffer(size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, &hostBuffer, &hostAllocation);
+		writeDescriptor(1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, hostBuffer, size);
+		break;
+	default:
+		break;
+	}
+}
+
+void UniformBenchmark::destroyResources(UniformUpdateStrategy strategy)
+{
+	switch (strategy)
+	{
+	case UniformUpdateStrategy::MapUnmap:
+		vkDestroyBuffer(device->getHandle(), mappedBuffer, nullptr);
+		vkFreeMemory(device->getHandle(), mappedMemory, nullptr);
+		break;
+	case UniformUpdateStrategy::PersistentMapping:
+		destroyBuffer(hostBuffer, hostAllocation);
+		break;
+	case UniformUpdateStrategy::DynamicRing:
+		ringBuffer.reset();
+		break;
+	case UniformUpdateStrategy::StagingCopy:
+		destroyBuffer(hostBuffer, hostAllocation);
+		destroyBuffer(deviceBuffer, deviceAllocation);
+		break;
+	case UniformUpdateStrategy::StorageBuffer:
+		destroyBuffer(hostBuffer, hostAllocation);
+		break;
+	default:
+		break;
+	}
+
+	destroyBuffer(resultBuffer, resultAllocation);
+	vkResetDescriptorPool(device->getHandle(), vkDescriptorPool, 0);
+}
+
+// The baseline strategy: a dedicated HOST_COHERENT allocation mapped and unmapped around every update.
+void UniformBenchmark::createMapUnmapBuffer(VkDeviceSize size)
+{
+	VkBufferCreateInfo bufferCreateInfo = {};
+	bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	bufferCreateInfo.size = size;
+	bufferCreateInfo.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+	bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+	VkResult result = vkCreateBuffer(device->getHandle(), &bufferCreateInfo, nullptr, &mappedBuffer);
+	throwIfCreateBufferFailed(result);
+
+	VkMemoryRequirements requirements;
+	vkGetBufferMemoryRequirements(device->getHandle(), mappedBuffer, &requirements);
+
+	VkMemoryAllocateInfo allocateInfo = {};
+	allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	allocateInfo.allocationSize = requirements.size;
+	allocateInfo.memoryTypeIndex = physicalDevice->findMemoryType(requirements.memoryTypeBits,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+	result = vkAllocateMemory(device->getHandle(), &allocateInfo, nullptr, &mappedMemory);
+	throwIfAllocateMemoryFailed(result);
+
+	vkBindBufferMemory(device->getHandle(), mappedBuffer, mappedMemory, 0);
+}
+
+void UniformBenchmark::createRingBuffer(uint32_t objectCount)
+{
+	ringBuffer = std::make_shared<UniformRingBuffer>(physicalDevice, device, memoryAllocator, 1,
+		sizeof(glm::mat4), objectCount);
+}
+
+void UniformBenchmark::allocateDescriptorSet()
+{
+	VkDescriptorSetLayout layout = benchmarkPipeline->getDescriptorSetLayoutHandle();
+
+	VkDescriptorSetAllocateInfo setAllocateInfo = {};
+	setAllocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+	setAllocateInfo.descriptorPool = vkDescriptorPool;
+	setAllocateInfo.descriptorSetCount = 1;
+	setAllocateInfo.pSetLayouts = &layout;
+
+	VkResult result = vkAllocateDescriptorSets(device->getHandle(), &setAllocateInfo, &vkDescriptorSet);
+	throwIfAllocateDescriptorSetFailed(result);
+}
+
+void UniformBenchmark::writeDescriptor(uint32_t binding, VkDescriptorType type, VkBuffer buffer,
+	VkDeviceSize range)
+{
+	VkDescriptorBufferInfo bufferInfo = {};
+	bufferInfo.buffer = buffer;
+	bufferInfo.offset = 0;
+	bufferInfo.range = range;
+
+	VkWriteDescriptorSet writeDescriptorSet = {};
+	writeDescriptorSet.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	writeDescriptorSet.dstSet = vkDescriptorSet;
+	writeDescriptorSet.dstBinding = binding;
+	writeDescriptorSet.descriptorType = type;
+	writeDescriptorSet.descriptorCount = 1;
+	writeDescriptorSet.pBufferInfo = &bufferInfo;
+
+	vkUpdateDescriptorSets(device->getHandle(), 1, &writeDescriptorSet, 0, nullptr);
+}
+
+void UniformBenchmark::updateObjects(UniformUpdateStrategy strategy, uint32_t objectCount)
+{
+	switch (strategy)
+	{
+	case UniformUpdateStrategy::MapUnmap:
+		updateWithMapUnmap(objectCount);
+		break;
+	case UniformUpdateStrategy::PersistentMapping:
+		updateWithPersistentMapping(objectCount);
+		break;
+	case UniformUpdateStrategy::DynamicRing:
+		updateWithDynamicRing(objectCount);
+		break;
+	case UniformUpdateStrategy::PushConstants:
+		updateWithPushConstants(objectCount);
+		break;
+	case UniformUpdateStrategy::StagingCopy:
+		updateWithStagingCopy(objectCount);
+		break;
+	case UniformUpdateStrategy::StorageBuffer:
+		updateWithStorageBuffer(objectCount);
+		break;
+	default:
+		break;
+	}
+}
+
+void UniformBenchmark::updateWithMapUnmap(uint32_t objectCount)
+{
+	VkDeviceSize size = objectStride * objectCount;
+
+	void* data;
+	VkResult result = vkMapMemory(device->getHandle(), mappedMemory, 0, size, 0, &data);
+	throwIfMapMemoryFailed(result);
+
+	writeStridedTransforms(static_cast<char*>(data), objectCount);
+	vkUnmapMemory(device->getHandle(), mappedMemory);
+
+	dispatchUniformObjects(objectCount);
+}
+
+void UniformBenchmark::updateWithPersistentMapping(uint32_t objectCount)
+{
+	writeStridedTransforms(static_cast<char*>(hostAllocation.mappedData), objectCount);
+	flushHostVisibleBuffer(hostAllocation, 0, objectStride * objectCount);
+
+	dispatchUniformObjects(objectCount);
+}
+
+void UniformBenchmark::updateWithDynamicRing(uint32_t objectCount)
+{
+	ringBuffer->beginFrame(0);
+	vkCmdBindPipeline(vkCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, benchmarkPipeline->getUniformHandle());
+
+	for (uint32_t i = 0; i < objectCount; ++i)
+	{
+		UniformSlice slice = ringBuffer->allocate(sizeof(glm::mat4));
+		memcpy(slice.data, &transforms[i], sizeof(glm::mat4));
+
+		dispatchUniformObject(i, slice.dynamicOffset);
+	}
+
+	ringBuffer->flush();
+}
+
+void UniformBenchmark::updateWithPushConstants(uint32_t objectCount)
+{
+	bindConsumer(benchmarkPipeline->getPushConstantHandle());
+
+	for (uint32_t i = 0; i < objectCount; ++i)
+	{
+		UniformBenchmarkPushConstants pushConstants = {};
+		pushConstants.model = transforms[i];
+		pushConstants.objectIndex = i;
+		pushConstants.objectCount = objectCount;
+
+		vkCmdPushConstants(vkCommandBuffer, benchmarkPipeline->getLayoutHandle(), VK_SHADER_STAGE_COMPUTE_BIT, 0,
+			sizeof(pushConstants), &pushConstants);
+		vkCmdDispatch(vkCommandBuffer, 1, 1, 1);
+	}
+}
+
+void UniformBenchmark::updateWithStagingCopy(uint32_t objectCount)
+{
+	VkDeviceSize size = sizeof(glm::mat4) * objectCount;
+
+	memcpy(hostAllocation.mappedData, transforms.data(), size);
+	flushHostVisibleBuffer(hostAllocation, 0, size);
+
+	VkBufferCopy region = {};
+	region.size = size;
+	vkCmdCopyBuffer(vkCommandBuffer, hostBuffer, deviceBuffer, 1, &region);
+
+	VkMemoryBarrier barrier = {};
+	barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+	barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+	vkCmdPipelineBarrier(vkCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+		1, &barrier, 0, nullptr, 0, nullptr);
+
+	dispatchStorageObjects(objectCount);
+}
+
+// The shader reads the host-visible array directly, so the only cost besides the dispatch is the packed memcpy.
+void UniformBenchmark::updateWithStorageBuffer(uint32_t objectCount)
+{
+	VkDeviceSize size = sizeof(glm::mat4) * objectCount;
+
+	memcpy(hostAllocation.mappedData, transforms.data(), size);
+	flushHostVisibleBuffer(hostAllocation, 0, size);
+
+	dispatchStorageObjects(objectCount);
+}
+
+void UniformBenchmark::writeStridedTransforms(char* data, uint32_t objectCount)
+{
+	for (uint32_t i = 0; i < objectCount; ++i)
+	{
+		memcpy(data + objectStride * i, &transforms[i], sizeof(glm::mat4));
+	}
+}
+
+// The set always carries the dynamic uniform binding, so strategies that do not read it bind it at offset 0.
+void UniformBenchmark::bindConsumer(VkPipeline pipeline)
+{
+	uint32_t dynamicOffset = 0;
+
+	vkCmdBindPipeline(vkCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+	vkCmdBindDescriptorSets(vkCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, benchmarkPipeline->getLayoutHandle(),
+		0, 1, &vkDescriptorSet, 1, &dynamicOffset);
+}
+
+void UniformBenchmark::dispatchUniformObject(uint32_t objectIndex, uint32_t dynamicOffset)
+{
+	vkCmdBindDescriptorSets(vkCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, benchmarkPipeline->getLayoutHandle(),
+		0, 1, &vkDescriptorSet, 1, &dynamicOffset);
+	vkCmdPushConstants(vkCommandBuffer, benchmarkPipeline->getLayoutHandle(), VK_SHADER_STAGE_COMPUTE_BIT,
+		offsetof(UniformBenchmarkPushConstants, objectIndex), sizeof(uint32_t), &objectIndex);
+	vkCmdDispatch(vkCommandBuffer, 1, 1, 1);
+}
+
+void UniformBenchmark::dispatchUniformObjects(uint32_t objectCount)
+{
+	vkCmdBindPipeline(vkCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, benchmarkPipeline->getUniformHandle());
+
+	for (uint32_t i = 0; i < objectCount; ++i)
+	{
+		dispatchUniformObject(i, static_cast<uint32_t>(objectStride * i));
+	}
+}
+
+void UniformBenchmark::dispatchStorageObjects(uint32_t objectCount)
+{
+	UniformBenchmarkPushConstants pushConstants = {};
+	pushConstants.objectCount = objectCount;
+
+	bindConsumer(benchmarkPipeline->getStorageHandle());
+	vkCmdPushConstants(vkCommandBuffer, benchmarkPipeline->getLayoutHandle(), VK_SHADER_STAGE_COMPUTE_BIT, 0,
+		sizeof(pushConstants), &pushConstants);
+	vkCmdDispatch(vkCommandBuffer, (objectCount + STORAGE_GROUP_SIZE - 1) / STORAGE_GROUP_SIZE, 1, 1);
+}
+
+void UniformBenchmark::beginCommandBuffer()
+{
+	vkResetCommandPool(device->getHandle(), commandPool->getHandle(), 0);
+
+	VkCommandBufferBeginInfo beginInfo = {};
+	beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+	vkBeginCommandBuffer(vkCommandBuffer, &beginInfo);
+}
+
+void UniformBenchmark::submitAndWait()
+{
+	VkSubmitInfo submitInfo = {};
+	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submitInfo.commandBufferCount = 1;
+	submitInfo.pCommandBuffers = &vkCommandBuffer;
+
+	VkResult result = vkQueueSubmit(device->getGraphicsQueueHandle(), 1, &submitInfo, vkFence);
+	throwIfSubmitFailed(result);
+
+	vkWaitForFences(device->getHandle(), 1, &vkFence, VK_TRUE, UINT64_MAX);
+	vkResetFences(device->getHandle(), 1, &vkFence);
+}
+
+void UniformBenchmark::createCommandBuffer()
+{
+	VkCommandBufferAllocateInfo allocateInfo = {};
+	allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+	allocateInfo.commandPool = commandPool->getHandle();
+	allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+	allocateInfo.commandBufferCount = 1;
+
+	VkResult result = vkAllocateCommandBuffers(device->getHandle(), &allocateInfo, &vkCommandBuffer);
+	throwIfAllocateCommandBufferFailed(result);
+}
+
+void UniformBenchmark::createFence()
+{
+	VkFenceCreateInfo createInfo = {};
+	createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+	VkResult result = vkCreateFence(device->getHandle(), &createInfo, nullptr, &vkFence);
+	throwIfCreateFenceFailed(result);
+}
+
+void UniformBenchmark::createDescriptorPool()
+{
+	VkDescriptorPoolSize poolSizes[2] = {};
+	poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+	poolSizes[0].descriptorCount = 1;
+	poolSizes[1].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	poolSizes[1].descriptorCount = 2;
+
+	VkDescriptorPoolCreateInfo createInfo = {};
+	createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+	createInfo.poolSizeCount = 2;
+	createInfo.pPoolSizes = poolSizes;
+	createInfo.maxSets = 1;
+
+	VkResult result = vkCreateDescriptorPool(device->getHandle(), &createInfo, nullptr, &vkDescriptorPool);
+	throwIfCreateDescriptorPoolFailed(result);
+}
+
+void UniformBenchmark::fillTransforms(uint32_t objectCount)
+{
+	transforms.resize(objectCount);
+
+	for (uint32_t i = 0; i < objectCount; ++i)
+	{
+		transforms[i] = glm::translate(glm::mat4(1.0f), glm::vec3(static_cast<float>(i % 100), 0.0f,
+			-static_cast<float>(i / 100)));
+	}
+}
+
+const char* UniformBenchmark::getStrategyName(UniformUpdateStrategy strategy)
+{
+	switch (strategy)
+	{
+	case UniformUpdateStrategy::MapUnmap:
+		return "map-unmap";
+	case UniformUpdateStrategy::PersistentMapping:
+		return "persistent-mapping";
+	case UniformUpdateStrategy::DynamicRing:
+		return "dynamic-ring";
+	case UniformUpdateStrategy::PushConstants:
+		return "push-constants";
+	case UniformUpdateStrategy::StagingCopy:
+		return "staging-copy";
+	case UniformUpdateStrategy::StorageBuffer:
+		return "storage-buffer";
+	default:
+		return "unknown";
+	}
+}
+
+void UniformBenchmark::throwIfAllocateCommandBufferFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to allocate benchmark command buffer.");
+	}
+}
+
+void UniformBenchmark::throwIfCreateFenceFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create benchmark fence.");
+	}
+}
+
+void UniformBenchmark::throwIfCreateDescriptorPoolFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create benchmark descriptor pool.");
+	}
+}
+
+void UniformBenchmark::throwIfAllocateDescriptorSetFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to allocate benchmark descriptor set.");
+	}
+}
+
+void UniformBenchmark::throwIfCreateBufferFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create benchmark buffer.");
+	}
+}
+
+void UniformBenchmark::throwIfAllocateMemoryFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to allocate benchmark memory.");
+	}
+}
+
+void UniformBenchmark::throwIfMapMemoryFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to map benchmark memory.");
+	}
+}
+
+void UniformBenchmark::throwIfSubmitFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to submit benchmark command buffer.");
+	}
+}
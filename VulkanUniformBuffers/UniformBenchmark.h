@@ -0,0 +1,90 @@
+#pragma once
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+
+#include <vulkan.h>
+#include <memory>
+#include <vector>
+#include "glm/mat4x4.hpp"
+#include "Buffer.h"
+#include "UniformBenchmarkResult.h"
+
+
+class PipelineCache;
+class ShaderPack;
+class CommandPool;
+class UniformRingBuffer;
+class UniformBenchmarkPipeline;
+
+
+class UniformBenchmark : public Buffer
+{
+private:
+	const uint32_t WARM_UP_FRAME_COUNT = 10;
+	const uint32_t STORAGE_GROUP_SIZE = 64;
+
+	std::shared_ptr<UniformBenchmarkPipeline> benchmarkPipeline;
+	std::shared_ptr<CommandPool> commandPool;
+	VkCommandBuffer vkCommandBuffer;
+	VkFence vkFence;
+	VkDescriptorPool vkDescriptorPool;
+	VkDescriptorSet vkDescriptorSet;
+	std::vector<glm::mat4> transforms;
+	VkDeviceSize objectStride;
+
+	VkBuffer hostBuffer;
+	MemoryAllocation hostAllocation;
+	VkBuffer deviceBuffer;
+	MemoryAllocation deviceAllocation;
+	VkBuffer mappedBuffer;
+	VkDeviceMemory mappedMemory;
+	std::shared_ptr<UniformRingBuffer> ringBuffer;
+	VkBuffer resultBuffer;
+	MemoryAllocation resultAllocation;
+
+	UniformBenchmarkResult run(UniformUpdateStrategy strategy, uint32_t objectCount, uint32_t frameCount);
+	void createResources(UniformUpdateStrategy strategy, uint32_t objectCount);
+	void destroyResources(UniformUpdateStrategy strategy);
+	void createMapUnmapBuffer(VkDeviceSize size);
+	void createRingBuffer(uint32_t objectCount);
+	void allocateDescriptorSet();
+	void writeDescriptor(uint32_t binding, VkDescriptorType type, VkBuffer buffer, VkDeviceSize range);
+	void updateObjects(UniformUpdateStrategy strategy, uint32_t objectCount);
+	void updateWithMapUnmap(uint32_t objectCount);
+	void updateWithPersistentMapping(uint32_t objectCount);
+	void updateWithDynamicRing(uint32_t objectCount);
+	void updateWithPushConstants(uint32_t objectCount);
+	void updateWithStagingCopy(uint32_t objectCount);
+	void updateWithStorageBuffer(uint32_t objectCount);
+	void writeStridedTransforms(char* data, uint32_t objectCount);
+	void bindConsumer(VkPipeline pipeline);
+	void dispatchUniformObject(uint32_t objectIndex, uint32_t dynamicOffset);
+	void dispatchUniformObjects(uint32_t objectCount);
+	void dispatchStorageObjects(uint32_t objectCount);
+	void beginCommandBuffer();
+	void submitAndWait();
+
+	void createCommandBuffer();
+	void createFence();
+	void createDescriptorPool();
+	void fillTransforms(uint32_t objectCount);
+	void throwIfAllocateCommandBufferFailed(VkResult result) const;
+	void throwIfCreateFenceFailed(VkResult result) const;
+	void throwIfCreateDescriptorPoolFailed(VkResult result) const;
+	void throwIfAllocateDescriptorSetFailed(VkResult result) const;
+	void throwIfCreateBufferFailed(VkResult result) const;
+	void throwIfAllocateMemoryFailed(VkResult result) const;
+	void throwIfMapMemoryFailed(VkResult result) const;
+	void throwIfSubmitFailed(VkResult result) const;
+
+public:
+	UniformBenchmark(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
+		std::shared_ptr<MemoryAllocator> memoryAllocator, std::shared_ptr<PipelineCache> pipelineCache,
+		std::shared_ptr<ShaderPack> shaderPack);
+
+	~UniformBenchmark();
+
+	std::vector<UniformBenchmarkResult> runAll(const std::vector<uint32_t>& objectCounts, uint32_t frameCount);
+	static const char* getStrategyName(UniformUpdateStrategy strategy);
+};
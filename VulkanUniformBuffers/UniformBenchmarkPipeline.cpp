@@ -0,0 +1,186 @@
+#include "UniformBenchmarkPipeline.h"
+#include "Device.h"
+#include "PipelineCache.h"
+#include "ShaderPack.h"
+#include "UniformBenchmarkPushConstants.h"
+#include <stdexcept>
+
+
+UniformBenchmarkPipeline::UniformBenchmarkPipeline(std::shared_ptr<Device> device,
+	std::shared_ptr<PipelineCache> pipelineCache, std::shared_ptr<ShaderPack> shaderPack)
+{
+	this->device = device;
+	this->pipelineCache = pipelineCache;
+	this->shaderPack = shaderPack;
+
+	createDescriptorSetLayout();
+	createPipelineLayout();
+	vkPushConstantPipeline = createPipeline("benchmark_push.spv");
+	vkUniformPipeline = createPipeline("benchmark_uniform.spv");
+	vkStoragePipeline = createPipeline("benchmark_storage.spv");
+}
+
+UniformBenchmarkPipeline::~UniformBenchmarkPipeline()
+{
+	vkDestroyPipeline(device->getHandle(), vkStoragePipeline, nullptr);
+	vkDestroyPipeline(device->getHandle(), vkUniformPipeline, nullptr);
+	vkDestroyPipeline(device->getHandle(), vkPushConstantPipeline, nullptr);
+	vkDestroyPipelineLayout(device->getHandle(), vkPipelineLayout, nullptr);
+	vkDestroyDescriptorSetLayout(device->getHandle(), vkDescriptorSetLayout, nullptr);
+}
+
+// Binding 0 is one object's uniform block, binding 1 the whole object array and binding 2 the results every
+// consumer writes, so no shader read can be optimized away.
+std::array<VkDescriptorSetLayoutBinding, 3> UniformBenchmarkPipeline::buildBindings() const
+{
+	std::array<VkDescriptorSetLayoutBinding, 3> bindings = {};
+
+	for (uint32_t i = 0; i < bindings.size(); ++i)
+	{
+		bindings[i].binding = i;
+		bindings[i].descriptorCount = 1;
+		bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+	}
+
+	bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+
+	return bindings;
+}
+
+VkPushConstantRange UniformBenchmarkPipeline::buildPushConstantRange() const
+{
+	VkPushConstantRange range = {};
+	range.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+	range.offset = 0;
+	range.size = sizeof(UniformBenchmarkPushConstants);
+
+	return range;
+}
+
+VkShaderModule UniformBenchmarkPipeline::loadShader(const char* name)
+{
+	ShaderCode shaderCode = shaderPack->getShaderCode(name);
+
+	VkShaderModuleCreateInfo createInfo = {};
+	createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+	createInfo.codeSize = shaderCode.size;
+	createInfo.pCode = shaderCode.code;
+
+	VkShaderModule shaderModule;
+	VkResult result = vkCreateShaderModule(device->getHandle(), &createInfo, nullptr, &shaderModule);
+	throwIfCreateShaderModuleFailed(result);
+
+	return shaderModule;
+}
+
+void UniformBenchmarkPipeline::createDescriptorSetLayout()
+{
+	std::array<VkDescriptorSetLayoutBinding, 3> bindings = buildBindings();
+
+	VkDescriptorSetLayoutCreateInfo createInfo = {};
+	createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+	createInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+	createInfo.pBindings = bindings.data();
+
+	VkResult result = vkCreateDescriptorSetLayout(device->getHandle(), &createInfo, nullptr,
+		&vkDescriptorSetLayout);
+	throwIfCreateDescriptorSetLayoutFailed(result);
+}
+
+void UniformBenchmarkPipeline::createPipelineLayout()
+{
+	VkPushConstantRange pushConstantRange = buildPushConstantRange();
+
+	VkPipelineLayoutCreateInfo createInfo = {};
+	createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+	createInfo.setLayoutCount = 1;
+	createInfo.pSetLayouts = &vkDescriptorSetLayout;
+	createInfo.pushConstantRangeCount = 1;
+	createInfo.pPushConstantRanges = &pushConstantRange;
+
+	VkResult result = vkCreatePipelineLayout(device->getHandle(), &createInfo, nullptr, &vkPipelineLayout);
+	throwIfCreatePipelineLayoutFailed(result);
+}
+
+VkPipeline UniformBenchmarkPipeline::createPipeline(const char* shaderName)
+{
+	VkShaderModule computeShader = loadShader(shaderName);
+
+	VkPipelineShaderStageCreateInfo stageCreateInfo = {};
+	stageCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	stageCreateInfo.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+	stageCreateInfo.module = computeShader;
+	stageCreateInfo.pName = "main";
+
+	VkComputePipelineCreateInfo createInfo = {};
+	createInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+	createInfo.stage = stageCreateInfo;
+	createInfo.layout = vkPipelineLayout;
+
+	VkPipeline pipeline;
+	VkResult result = vkCreateComputePipelines(device->getHandle(), pipelineCache->getHandle(), 1, &createInfo,
+		nullptr, &pipeline);
+
+	vkDestroyShaderModule(device->getHandle(), computeShader, nullptr);
+	throwIfCreatePipelineFailed(result);
+
+	return pipeline;
+}
+
+void UniformBenchmarkPipeline::throwIfCreateDescriptorSetLayoutFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create benchmark descriptor set layout.");
+	}
+}
+
+void UniformBenchmarkPipeline::throwIfCreatePipelineLayoutFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create benchmark pipeline layout.");
+	}
+}
+
+void UniformBenchmarkPipeline::throwIfCreateShaderModuleFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create shader module.");
+	}
+}
+
+void UniformBenchmarkPipeline::throwIfCreatePipelineFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create benchmark pipeline.");
+	}
+}
+
+VkDescriptorSetLayout UniformBenchmarkPipeline::getDescriptorSetLayoutHandle() const
+{
+	return vkDescriptorSetLayout;
+}
+
+VkPipelineLayout UniformBenchmarkPipeline::getLayoutHandle() const
+{
+	return vkPipelineLayout;
+}
+
+VkPipeline UniformBenchmarkPipeline::getPushConstantHandle() const
+{
+	return vkPushConstantPipeline;
+}
+
+VkPipeline UniformBenchmarkPipeline::getUniformHandle() const
+{
+	return vkUniformPipeline;
+}
+
+VkPipeline UniformBenchmarkPipeline::getStorageHandle() const
+{
+	return vkStoragePipeline;
+}
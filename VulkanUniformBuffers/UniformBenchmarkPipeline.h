@@ -0,0 +1,47 @@
+#pragma once
+
+#include <vulkan.h>
+#include <memory>
+#include <array>
+
+
+class Device;
+class PipelineCache;
+class ShaderPack;
+
+
+class UniformBenchmarkPipeline
+{
+private:
+	std::shared_ptr<Device> device;
+	std::shared_ptr<PipelineCache> pipelineCache;
+	std::shared_ptr<ShaderPack> shaderPack;
+	VkDescriptorSetLayout vkDescriptorSetLayout;
+	VkPipelineLayout vkPipelineLayout;
+	VkPipeline vkPushConstantPipeline;
+	VkPipeline vkUniformPipeline;
+	VkPipeline vkStoragePipeline;
+
+	std::array<VkDescriptorSetLayoutBinding, 3> buildBindings() const;
+	VkPushConstantRange buildPushConstantRange() const;
+	VkShaderModule loadShader(const char* name);
+	void createDescriptorSetLayout();
+	void createPipelineLayout();
+	VkPipeline createPipeline(const char* shaderName);
+	void throwIfCreateDescriptorSetLayoutFailed(VkResult result) const;
+	void throwIfCreatePipelineLayoutFailed(VkResult result) const;
+	void throwIfCreateShaderModuleFailed(VkResult result) const;
+	void throwIfCreatePipelineFailed(VkResult result) const;
+
+public:
+	UniformBenchmarkPipeline(std::shared_ptr<Device> device, std::shared_ptr<PipelineCache> pipelineCache,
+		std::shared_ptr<ShaderPack> shaderPack);
+
+	~UniformBenchmarkPipeline();
+
+	VkDescriptorSetLayout getDescriptorSetLayoutHandle() const;
+	VkPipelineLayout getLayoutHandle() const;
+	VkPipeline getPushConstantHandle() const;
+	VkPipeline getUniformHandle() const;
+	VkPipeline getStorageHandle() const;
+};
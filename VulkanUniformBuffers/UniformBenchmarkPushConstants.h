@@ -0,0 +1,15 @@
+#pragma once
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+
+#include "glm/mat4x4.hpp"
+#include <cstdint>
+
+
+struct UniformBenchmarkPushConstants
+{
+	glm::mat4 model;
+	uint32_t objectIndex;
+	uint32_t objectCount;
+};
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+#include "UniformUpdateStrategy.h"
+#include "FrameStats.h"
+
+
+struct UniformBenchmarkResult
+{
+	UniformUpdateStrategy strategy;
+	uint32_t objectCount;
+	FrameStats recordStats;
+	FrameStats consumeStats;
+};
@@ -22,53 +22,46 @@
 
 struct UniformBufferObject
 {
-	glm::mat4 model;
 	glm::mat4 view;
 	glm::mat4 projection;
+	glm::mat4 viewProjection;
 };
 
 class SwapChain;
 class DescriptorSetLayout;
-struct InputState;
+class MemoryAllocator;
+class UniformRingBuffer;
+class Camera;
 
 
 class UniformBuffer : public Buffer
 {
 private:
-	const float angleSpeed = 0.01f;
-	const float speed = 1.0f;
-	const glm::vec3 xUnit;
-	const glm::vec3 yUnit;
-	const glm::vec3 zUnit;
+	const uint32_t MAX_SLICES_PER_FRAME = 256;
 
-	std::vector<VkBuffer> vkUniformBuffers;
-	std::vector<VkDeviceMemory> vkUniformDeviceMemory;
+	std::shared_ptr<UniformRingBuffer> ringBuffer;
 	UniformBufferObject uniformBufferObject;
 	std::shared_ptr<SwapChain> swapChain;
 	std::shared_ptr<DescriptorSetLayout> descriptorSetLayout;
 	VkDescriptorPool vkUniformDescriptorPool;
-	std::vector<VkDescriptorSet> vkUniformDescriptorSets;
-	glm::vec3 viewPosition;
-	glm::vec3 viewRotation;
+	VkDescriptorSet vkUniformDescriptorSet;
 
+	void createRingBuffer();
+	void writeDescriptorSet();
 	void throwIfAllocateDescriptorSetsFailed(VkResult result) const;
 	void throwIfCreateDescriptorPoolFailed(VkResult result) const;
-	void moveMouse(const InputState & inputState);
-	void moveBackward(float deltaSec);
-	void moveForward(float deltaSec);
-	void rotateRight(float deltaSec);
-	void rotateLeft(float deltaSec);
 
 public:
 	UniformBuffer(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device, 
-		std::shared_ptr<SwapChain> swapChain, std::shared_ptr<DescriptorSetLayout> descriptorSetLayout);
+		std::shared_ptr<MemoryAllocator> memoryAllocator, std::shared_ptr<SwapChain> swapChain, std::shared_ptr<DescriptorSetLayout> descriptorSetLayout);
 
 	~UniformBuffer();
 
-	void updateUniformBufferObject(const InputState& inputState, float deltaSec);
 	void createDescriptorSets();
 	void createDescriptorPool();
-	void initScene();
-	void updateUniformBuffer(uint32_t imageIndex);
-	VkDescriptorSet* getDescriptorSetHandlePtr(uint32_t index);
+	void updateSwapChain(std::shared_ptr<SwapChain> swapChain);
+	void updateUniformBuffer(uint32_t imageIndex, const Camera& camera);
+	VkDescriptorSet* getDescriptorSetHandlePtr();
+	uint32_t getDynamicOffset(uint32_t imageIndex) const;
+	VkBuffer getBufferHandle() const;
 };
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include "UniformRingBuffer.h"
+#include "PhysicalDevice.h"
+#include <stdexcept>
+
+
+UniformRingBuffer::UniformRingBuffer(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
+	std::shared_ptr<MemoryAllocator> memoryAllocator, uint32_t frameCount, VkDeviceSize sliceSize, uint32_t slicesPerFrame)
+	: Buffer(physicalDevice, device, memoryAllocator)
+{
+	alignment = physicalDevice->getProperties().limits.minUniformBufferOffsetAlignment;
+	if (alignment == 0)
+	{
+		alignment = 1;
+	}
+
+	this->frameCount = frameCount;
+	frameSize = alignUp(sliceSize) * slicesPerFrame;
+	frameBegin = 0;
+	head = 0;
+
+	createHostVisibleBuffer(frameSize * frameCount, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, &vkBuffer, &allocation);
+	throwIfNotMapped();
+}
+
+UniformRingBuffer::~UniformRingBuffer()
+{
+	destroyBuffer(vkBuffer, allocation);
+}
+
+void UniformRingBuffer::beginFrame(uint32_t frameIndex)
+{
+	throwIfFrameIndexOutOfRange(frameIndex);
+
+	frameBegin = frameSize * frameIndex;
+	head = frameBegin;
+}
+
+UniformSlice UniformRingBuffer::allocate(VkDeviceSize size)
+{
+	VkDeviceSize end = head + alignUp(size);
+	throwIfFrameFull(end);
+
+	UniformSlice slice = {};
+	slice.dynamicOffset = static_cast<uint32_t>(head);
+	slice.data = static_cast<char*>(allocation.mappedData) + head;
+
+	head = end;
+	return slice;
+}
+
+void UniformRingBuffer::flush()
+{
+	if (head > frameBegin)
+	{
+		flushHostVisibleBuffer(allocation, frameBegin, head - frameBegin);
+	}
+}
+
+uint32_t UniformRingBuffer::getFrameOffset(uint32_t frameIndex) const
+{
+	throwIfFrameIndexOutOfRange(frameIndex);
+	return static_cast<uint32_t>(frameSize * frameIndex);
+}
+
+VkBuffer UniformRingBuffer::getHandle() const
+{
+	return vkBuffer;
+}
+
+VkDeviceSize UniformRingBuffer::alignUp(VkDeviceSize value) const
+{
+	return (value + alignment - 1) / alignment * alignment;
+}
+
+void UniformRingBuffer::throwIfNotMapped() const
+{
+	if (allocation.mappedData == nullptr)
+	{
+		throw std::runtime_error("Uniform ring buffer memory is not host mapped.");
+	}
+}
+
+void UniformRingBuffer::throwIfFrameIndexOutOfRange(uint32_t frameIndex) const
+{
+	if (frameIndex >= frameCount)
+	{
+		throw std::runtime_error("Uniform ring buffer frame index is out of range.");
+	}
+}
+
+void UniformRingBuffer::throwIfFrameFull(VkDeviceSize end) const
+{
+	if (end > frameBegin + frameSize)
+	{
+		throw std::runtime_error("Uniform ring buffer frame capacity exceeded.");
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vulkan.h>
+#include <memory>
+#include "Buffer.h"
+
+
+struct UniformSlice
+{
+	uint32_t dynamicOffset;
+	void* data;
+};
+
+
+class UniformRingBuffer : public Buffer
+{
+private:
+	VkBuffer vkBuffer;
+	MemoryAllocation allocation;
+	VkDeviceSize alignment;
+	VkDeviceSize frameSize;
+	uint32_t frameCount;
+	VkDeviceSize frameBegin;
+	VkDeviceSize head;
+
+	VkDeviceSize alignUp(VkDeviceSize value) const;
+	void throwIfNotMapped() const;
+	void throwIfFrameIndexOutOfRange(uint32_t frameIndex) const;
+	void throwIfFrameFull(VkDeviceSize end) const;
+
+public:
+	UniformRingBuffer(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
+		std::shared_ptr<MemoryAllocator> memoryAllocator, uint32_t frameCount, VkDeviceSize sliceSize, uint32_t slicesPerFrame);
+
+	~UniformRingBuffer();
+
+	void beginFrame(uint32_t frameIndex);
+	UniformSlice allocate(VkDeviceSize size);
+	void flush();
+	uint32_t getFrameOffset(uint32_t frameIndex) const;
+	VkBuffer getHandle() const;
+};
@@ -0,0 +1,12 @@
+#pragma once
+
+
+enum class UniformUpdateStrategy
+{
+	MapUnmap,
+	PersistentMapping,
+	DynamicRing,
+	PushConstants,
+	StagingCopy,
+	StorageBuffer
+};
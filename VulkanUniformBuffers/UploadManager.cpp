@@ -0,0 +1,497 @@
+#include "UploadManager.h"
+#include "Device.h"
+#include "CommandPool.h"
+#include "PhysicalDevice.h"
+#include "TimelineSemaphore.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+
+UploadManager::UploadManager(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
+	std::shared_ptr<MemoryAllocator> memoryAllocator, std::shared_ptr<CommandPool> commandPool,
+	std::shared_ptr<CommandPool> transferCommandPool, bool timelineEnabled)
+	: Buffer(physicalDevice, device, memoryAllocator)
+{
+	this->commandPool = commandPool;
+	this->transferCommandPool = transferCommandPool;
+
+	QueueFamilyIndices queueFamilyIndices = physicalDevice->getQueueFamilyIndices();
+	graphicsFamilyIndex = queueFamilyIndices.graphics.value();
+	transferFamilyIndex = queueFamilyIndices.transfer.value_or(graphicsFamilyIndex);
+
+	stagingHead = 0;
+	nextBatchId = 1;
+	completedBatchId = 0;
+
+	// Batch ids are the values their submits signal, so batch N is complete once the timeline is >= N.
+	if (timelineEnabled)
+	{
+		uploadTimeline = std::make_shared<TimelineSemaphore>(device, 0);
+	}
+
+	createHostVisibleBuffer(STAGING_ARENA_SIZE, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, &stagingArena.vkBuffer,
+		&stagingArena.allocation);
+}
+
+UploadManager::~UploadManager()
+{
+	submit();
+	waitIdle();
+
+	destroyBuffer(stagingArena.vkBuffer, stagingArena.allocation);
+}
+
+void UploadManager::upload(VkBuffer dstBuffer, VkDeviceSize dstOffset, const void* data, VkDeviceSize size)
+{
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+
+	if (size > STAGING_ARENA_SIZE)
+	{
+		stageIntoDedicatedBuffer(dstBuffer, dstOffset, data, size);
+		return;
+	}
+
+	collectCompletedBatches();
+
+	if (alignUp(stagingHead) + size > STAGING_ARENA_SIZE)
+	{
+		submit();
+		waitIdle();
+	}
+
+	stageIntoArena(dstBuffer, dstOffset, data, size);
+}
+
+void UploadManager::stageIntoArena(VkBuffer dstBuffer, VkDeviceSize dstOffset, const void* data, VkDeviceSize size)
+{
+	VkDeviceSize srcOffset = alignUp(stagingHead);
+	memcpy(static_cast<char*>(stagingArena.allocation.mappedData) + srcOffset, data, size);
+	flushHostVisibleBuffer(stagingArena.allocation, srcOffset, size);
+	stagingHead = srcOffset + size;
+
+	UploadCopy copy = {};
+	copy.srcBuffer = stagingArena.vkBuffer;
+	copy.dstBuffer = dstBuffer;
+	copy.region.srcOffset = srcOffset;
+	copy.region.dstOffset = dstOffset;
+	copy.region.size = size;
+	pendingCopies.push_back(copy);
+}
+
+void UploadManager::stageIntoDedicatedBuffer(VkBuffer dstBuffer, VkDeviceSize dstOffset, const void* data,
+	VkDeviceSize size)
+{
+	StagingBuffer stagingBuffer = {};
+	createHostVisibleBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, &stagingBuffer.vkBuffer, &stagingBuffer.allocation);
+
+	memcpy(stagingBuffer.allocation.mappedData, data, size);
+	flushHostVisibleBuffer(stagingBuffer.allocation, 0, size);
+	pendingDedicatedStagingBuffers.push_back(stagingBuffer);
+
+	UploadCopy copy = {};
+	copy.srcBuffer = stagingBuffer.vkBuffer;
+	copy.dstBuffer = dstBuffer;
+	copy.region.srcOffset = 0;
+	copy.region.dstOffset = dstOffset;
+	copy.region.size = size;
+	pendingCopies.push_back(copy);
+}
+
+uint64_t UploadManager::submit()
+{
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+
+	if (pendingCopies.empty())
+	{
+		return nextBatchId - 1;
+	}
+
+	UploadBatch batch = {};
+	batch.id = nextBatchId++;
+	batch.vkFence = uploadTimeline ? VK_NULL_HANDLE : createFence();
+	batch.dedicatedStagingBuffers.swap(pendingDedicatedStagingBuffers);
+
+	if (usesTransferQueue())
+	{
+		submitToTransferQueue(&batch);
+	}
+	else
+	{
+		submitToGraphicsQueue(&batch);
+	}
+
+	pendingCopies.clear();
+	batchesInFlight.push_back(std::move(batch));
+
+	return batchesInFlight.back().id;
+}
+
+void UploadManager::submitToGraphicsQueue(UploadBatch* batch)
+{
+	batch->vkCommandBuffer = allocateCommandBuffer(commandPool);
+
+	beginCommandBuffer(batch->vkCommandBuffer);
+	recordCopies(batch->vkCommandBuffer);
+	recordVisibilityBarrier(batch->vkCommandBuffer);
+	endCommandBuffer(batch->vkCommandBuffer);
+
+	VkSubmitInfo submitInfo = {};
+	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submitInfo.commandBufferCount = 1;
+	submitInfo.pCommandBuffers = &batch->vkCommandBuffer;
+
+	submitCompletion(&submitInfo, *batch);
+}
+
+void UploadManager::submitToTransferQueue(UploadBatch* batch)
+{
+	batch->vkCommandBuffer = allocateCommandBuffer(transferCommandPool);
+	batch->vkAcquireCommandBuffer = allocateCommandBuffer(commandPool);
+	batch->vkTransferSemaphore = createSemaphore();
+
+	beginCommandBuffer(batch->vkCommandBuffer);
+	recordCopies(batch->vkCommandBuffer);
+	recordOwnershipBarriers(batch->vkCommandBuffer, true);
+	endCommandBuffer(batch->vkCommandBuffer);
+
+	beginCommandBuffer(batch->vkAcquireCommandBuffer);
+	recordOwnershipBarriers(batch->vkAcquireCommandBuffer, false);
+	endCommandBuffer(batch->vkAcquireCommandBuffer);
+
+	VkSubmitInfo transferSubmitInfo = {};
+	transferSubmitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	transferSubmitInfo.commandBufferCount = 1;
+	transferSubmitInfo.pCommandBuffers = &batch->vkCommandBuffer;
+	transferSubmitInfo.signalSemaphoreCount = 1;
+	transferSubmitInfo.pSignalSemaphores = &batch->vkTransferSemaphore;
+
+	VkResult result = vkQueueSubmit(device->getTransferQueueHandle(), 1, &transferSubmitInfo, VK_NULL_HANDLE);
+	throwIfSubmitFailed(result);
+
+	VkSubmitInfo acquireSubmitInfo = {};
+	acquireSubmitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	acquireSubmitInfo.waitSemaphoreCount = 1;
+	acquireSubmitInfo.pWaitSemaphores = &batch->vkTransferSemaphore;
+	acquireSubmitInfo.pWaitDstStageMask = &CONSUMER_STAGE_MASK;
+	acquireSubmitInfo.commandBufferCount = 1;
+	acquireSubmitInfo.pCommandBuffers = &batch->vkAcquireCommandBuffer;
+
+	submitCompletion(&acquireSubmitInfo, *batch);
+}
+
+// The last submit of a batch signals either its id on the upload timeline or its fence.
+void UploadManager::submitCompletion(VkSubmitInfo* submitInfo, const UploadBatch& batch)
+{
+	VkSemaphore timelineSemaphore = VK_NULL_HANDLE;
+	std::vector<uint64_t> waitValues(submitInfo->waitSemaphoreCount, 0);
+	VkTimelineSemaphoreSubmitInfoKHR timelineSubmitInfo = {};
+
+	if (uploadTimeline)
+	{
+		timelineSemaphore = uploadTimeline->getHandle();
+
+		timelineSubmitInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+		timelineSubmitInfo.waitSemaphoreValueCount = static_cast<uint32_t>(waitValues.size());
+		timelineSubmitInfo.pWaitSemaphoreValues = waitValues.data();
+		timelineSubmitInfo.signalSemaphoreValueCount = 1;
+		timelineSubmitInfo.pSignalSemaphoreValues = &batch.id;
+
+		submitInfo->pNext = &timelineSubmitInfo;
+		submitInfo->signalSemaphoreCount = 1;
+		submitInfo->pSignalSemaphores = &timelineSemaphore;
+	}
+
+	VkResult result = vkQueueSubmit(device->getGraphicsQueueHandle(), 1, submitInfo, batch.vkFence);
+	throwIfSubmitFailed(result);
+}
+
+void UploadManager::recordCopies(VkCommandBuffer commandBuffer) const
+{
+	size_t first = 0;
+	std::vector<VkBufferCopy> regions;
+
+	while (first < pendingCopies.size())
+	{
+		const UploadCopy& firstCopy = pendingCopies[first];
+		regions.clear();
+
+		size_t last = first;
+		while (last < pendingCopies.size() && pendingCopies[last].srcBuffer == firstCopy.srcBuffer &&
+			pendingCopies[last].dstBuffer == firstCopy.dstBuffer)
+		{
+			regions.push_back(pendingCopies[last].region);
+			++last;
+		}
+
+		vkCmdCopyBuffer(commandBuffer, firstCopy.srcBuffer, firstCopy.dstBuffer,
+			static_cast<uint32_t>(regions.size()), regions.data());
+
+		first = last;
+	}
+}
+
+void UploadManager::recordVisibilityBarrier(VkCommandBuffer commandBuffer) const
+{
+	VkMemoryBarrier barrier = {};
+	barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+	barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.dstAccessMask = CONSUMER_ACCESS_MASK;
+
+	vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, CONSUMER_STAGE_MASK,
+		0, 1, &barrier, 0, nullptr, 0, nullptr);
+}
+
+void UploadManager::recordOwnershipBarriers(VkCommandBuffer commandBuffer, bool release) const
+{
+	std::vector<VkBuffer> dstBuffers;
+	std::vector<VkBufferMemoryBarrier> barriers;
+
+	for (const UploadCopy& copy : pendingCopies)
+	{
+		if (std::find(dstBuffers.begin(), dstBuffers.end(), copy.dstBuffer) != dstBuffers.end())
+		{
+			continue;
+		}
+
+		dstBuffers.push_back(copy.dstBuffer);
+
+		VkBufferMemoryBarrier barrier = {};
+		barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		barrier.srcAccessMask = release ? VK_ACCESS_TRANSFER_WRITE_BIT : 0;
+		barrier.dstAccessMask = release ? 0 : CONSUMER_ACCESS_MASK;
+		barrier.srcQueueFamilyIndex = transferFamilyIndex;
+		barrier.dstQueueFamilyIndex = graphicsFamilyIndex;
+		barrier.buffer = copy.dstBuffer;
+		barrier.offset = 0;
+		barrier.size = VK_WHOLE_SIZE;
+		barriers.push_back(barrier);
+	}
+
+	VkPipelineStageFlags srcStageMask = release ? VK_PIPELINE_STAGE_TRANSFER_BIT : CONSUMER_STAGE_MASK;
+	VkPipelineStageFlags dstStageMask = release ? VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT : CONSUMER_STAGE_MASK;
+
+	vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, 0, 0, nullptr,
+		static_cast<uint32_t>(barriers.size()), barriers.data(), 0, nullptr);
+}
+
+void UploadManager::beginCommandBuffer(VkCommandBuffer commandBuffer) const
+{
+	VkCommandBufferBeginInfo beginInfo = {};
+	beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+	VkResult result = vkBeginCommandBuffer(commandBuffer, &beginInfo);
+	throwIfBeginCommandBufferFailed(result);
+}
+
+void UploadManager::endCommandBuffer(VkCommandBuffer commandBuffer) const
+{
+	VkResult result = vkEndCommandBuffer(commandBuffer);
+	throwIfEndCommandBufferFailed(result);
+}
+
+bool UploadManager::isComplete(uint64_t batchId)
+{
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+
+	collectCompletedBatches();
+	return batchId <= completedBatchId;
+}
+
+void UploadManager::wait(uint64_t batchId)
+{
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+
+	if (batchId <= completedBatchId)
+	{
+		return;
+	}
+
+	if (uploadTimeline)
+	{
+		uploadTimeline->wait(std::min(batchId, nextBatchId - 1));
+		collectCompletedBatches();
+		return;
+	}
+
+	for (const UploadBatch& batch : batchesInFlight)
+	{
+		if (batch.id >= batchId)
+		{
+			VkResult result = vkWaitForFences(device->getHandle(), 1, &batch.vkFence, VK_TRUE, UINT64_MAX);
+			throwIfWaitFailed(result);
+			break;
+		}
+	}
+
+	collectCompletedBatches();
+}
+
+void UploadManager::waitIdle()
+{
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+
+	if (!batchesInFlight.empty())
+	{
+		wait(batchesInFlight.back().id);
+	}
+}
+
+bool UploadManager::isBatchComplete(const UploadBatch& batch) const
+{
+	if (uploadTimeline)
+	{
+		return uploadTimeline->isReached(batch.id);
+	}
+
+	return vkGetFenceStatus(device->getHandle(), batch.vkFence) == VK_SUCCESS;
+}
+
+void UploadManager::collectCompletedBatches()
+{
+	size_t completedCount = 0;
+
+	while (completedCount < batchesInFlight.size() && isBatchComplete(batchesInFlight[completedCount]))
+	{
+		completedBatchId = batchesInFlight[completedCount].id;
+		releaseBatch(batchesInFlight[completedCount]);
+		++completedCount;
+	}
+
+	batchesInFlight.erase(batchesInFlight.begin(), batchesInFlight.begin() + completedCount);
+
+	if (batchesInFlight.empty() && pendingCopies.empty())
+	{
+		stagingHead = 0;
+	}
+}
+
+void UploadManager::releaseBatch(UploadBatch& batch)
+{
+	for (const StagingBuffer& stagingBuffer : batch.dedicatedStagingBuffers)
+	{
+		destroyBuffer(stagingBuffer.vkBuffer, stagingBuffer.allocation);
+	}
+
+	if (batch.vkAcquireCommandBuffer != VK_NULL_HANDLE)
+	{
+		vkFreeCommandBuffers(device->getHandle(), commandPool->getHandle(), 1, &batch.vkAcquireCommandBuffer);
+		vkFreeCommandBuffers(device->getHandle(), transferCommandPool->getHandle(), 1, &batch.vkCommandBuffer);
+		vkDestroySemaphore(device->getHandle(), batch.vkTransferSemaphore, nullptr);
+	}
+	else
+	{
+		vkFreeCommandBuffers(device->getHandle(), commandPool->getHandle(), 1, &batch.vkCommandBuffer);
+	}
+
+	if (batch.vkFence != VK_NULL_HANDLE)
+	{
+		vkDestroyFence(device->getHandle(), batch.vkFence, nullptr);
+	}
+}
+
+VkCommandBuffer UploadManager::allocateCommandBuffer(std::shared_ptr<CommandPool> pool)
+{
+	VkCommandBufferAllocateInfo allocateInfo = {};
+	allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+	allocateInfo.commandPool = pool->getHandle();
+	allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+	allocateInfo.commandBufferCount = 1;
+
+	VkCommandBuffer commandBuffer;
+	VkResult result = vkAllocateCommandBuffers(device->getHandle(), &allocateInfo, &commandBuffer);
+	throwIfAllocateCommandBufferFailed(result);
+
+	return commandBuffer;
+}
+
+VkSemaphore UploadManager::createSemaphore()
+{
+	VkSemaphoreCreateInfo semaphoreCreateInfo = {};
+	semaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+
+	VkSemaphore semaphore;
+	VkResult result = vkCreateSemaphore(device->getHandle(), &semaphoreCreateInfo, nullptr, &semaphore);
+	throwIfCreateSemaphoreFailed(result);
+
+	return semaphore;
+}
+
+VkFence UploadManager::createFence()
+{
+	VkFenceCreateInfo fenceCreateInfo = {};
+	fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+	VkFence fence;
+	VkResult result = vkCreateFence(device->getHandle(), &fenceCreateInfo, nullptr, &fence);
+	throwIfCreateFenceFailed(result);
+
+	return fence;
+}
+
+bool UploadManager::usesTransferQueue() const
+{
+	return transferCommandPool != nullptr && transferFamilyIndex != graphicsFamilyIndex;
+}
+
+VkDeviceSize UploadManager::alignUp(VkDeviceSize value) const
+{
+	return (value + STAGING_ALIGNMENT - 1) / STAGING_ALIGNMENT * STAGING_ALIGNMENT;
+}
+
+void UploadManager::throwIfAllocateCommandBufferFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to allocate upload command buffer.");
+	}
+}
+
+void UploadManager::throwIfBeginCommandBufferFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to begin upload command buffer.");
+	}
+}
+
+void UploadManager::throwIfEndCommandBufferFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to end upload command buffer.");
+	}
+}
+
+void UploadManager::throwIfCreateSemaphoreFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create upload semaphore.");
+	}
+}
+
+void UploadManager::throwIfCreateFenceFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create upload fence.");
+	}
+}
+
+void UploadManager::throwIfSubmitFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to submit upload batch.");
+	}
+}
+
+void UploadManager::throwIfWaitFailed(VkResult result) const
+{
+	if (result != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to wait for upload batch.");
+	}
+}
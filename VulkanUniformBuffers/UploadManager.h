@@ -0,0 +1,99 @@
+#pragma once
+
+#include <vulkan.h>
+#include <memory>
+#include <vector>
+#include <mutex>
+#include "Buffer.h"
+
+class CommandPool;
+class TimelineSemaphore;
+
+
+struct StagingBuffer
+{
+	VkBuffer vkBuffer;
+	MemoryAllocation allocation;
+};
+
+struct UploadCopy
+{
+	VkBuffer srcBuffer;
+	VkBuffer dstBuffer;
+	VkBufferCopy region;
+};
+
+struct UploadBatch
+{
+	uint64_t id;
+	VkCommandBuffer vkCommandBuffer;
+	VkCommandBuffer vkAcquireCommandBuffer;
+	VkSemaphore vkTransferSemaphore;
+	VkFence vkFence;
+	std::vector<StagingBuffer> dedicatedStagingBuffers;
+};
+
+
+class UploadManager : public Buffer
+{
+private:
+	const VkDeviceSize STAGING_ARENA_SIZE = 16ull * 1024 * 1024;
+	const VkDeviceSize STAGING_ALIGNMENT = 16;
+	const VkAccessFlags CONSUMER_ACCESS_MASK = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT |
+		VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+	const VkPipelineStageFlags CONSUMER_STAGE_MASK = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT |
+		VK_PIPELINE_STAGE_VERTEX_SHADER_BIT;
+
+	std::shared_ptr<CommandPool> commandPool;
+	std::shared_ptr<CommandPool> transferCommandPool;
+	uint32_t graphicsFamilyIndex;
+	uint32_t transferFamilyIndex;
+	StagingBuffer stagingArena;
+	VkDeviceSize stagingHead;
+	std::vector<UploadCopy> pendingCopies;
+	std::vector<StagingBuffer> pendingDedicatedStagingBuffers;
+	std::vector<UploadBatch> batchesInFlight;
+	std::shared_ptr<TimelineSemaphore> uploadTimeline;
+	uint64_t nextBatchId;
+	uint64_t completedBatchId;
+	std::recursive_mutex mutex;
+
+	void stageIntoArena(VkBuffer dstBuffer, VkDeviceSize dstOffset, const void* data, VkDeviceSize size);
+	void stageIntoDedicatedBuffer(VkBuffer dstBuffer, VkDeviceSize dstOffset, const void* data, VkDeviceSize size);
+	void submitToGraphicsQueue(UploadBatch* batch);
+	void submitToTransferQueue(UploadBatch* batch);
+	void submitCompletion(VkSubmitInfo* submitInfo, const UploadBatch& batch);
+	void recordCopies(VkCommandBuffer commandBuffer) const;
+	void recordVisibilityBarrier(VkCommandBuffer commandBuffer) const;
+	void recordOwnershipBarriers(VkCommandBuffer commandBuffer, bool release) const;
+	void beginCommandBuffer(VkCommandBuffer commandBuffer) const;
+	void endCommandBuffer(VkCommandBuffer commandBuffer) const;
+	VkCommandBuffer allocateCommandBuffer(std::shared_ptr<CommandPool> pool);
+	VkSemaphore createSemaphore();
+	VkFence createFence();
+	bool usesTransferQueue() const;
+	bool isBatchComplete(const UploadBatch& batch) const;
+	void collectCompletedBatches();
+	void releaseBatch(UploadBatch& batch);
+	VkDeviceSize alignUp(VkDeviceSize value) const;
+	void throwIfAllocateCommandBufferFailed(VkResult result) const;
+	void throwIfBeginCommandBufferFailed(VkResult result) const;
+	void throwIfEndCommandBufferFailed(VkResult result) const;
+	void throwIfCreateSemaphoreFailed(VkResult result) const;
+	void throwIfCreateFenceFailed(VkResult result) const;
+	void throwIfSubmitFailed(VkResult result) const;
+	void throwIfWaitFailed(VkResult result) const;
+
+public:
+	UploadManager(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
+		std::shared_ptr<MemoryAllocator> memoryAllocator, std::shared_ptr<CommandPool> commandPool,
+		std::shared_ptr<CommandPool> transferCommandPool, bool timelineEnabled);
+
+	~UploadManager();
+
+	void upload(VkBuffer dstBuffer, VkDeviceSize dstOffset, const void* data, VkDeviceSize size);
+	uint64_t submit();
+	bool isComplete(uint64_t batchId);
+	void wait(uint64_t batchId);
+	void waitIdle();
+};
@@ -1,44 +1,26 @@
 #include "VertexBuffer.h"
+#include <algorithm>
 #include "Vertex.h"
 #include "Device.h"
-#include "CommandPool.h"
+#include "UploadManager.h"
+#include <glm/glm.hpp>
 
 
 VertexBuffer::VertexBuffer(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
-	std::shared_ptr<CommandPool> commandPool)
-	: Buffer(physicalDevice, device)
+	std::shared_ptr<MemoryAllocator> memoryAllocator, std::shared_ptr<UploadManager> uploadManager)
+	: Buffer(physicalDevice, device, memoryAllocator)
 {
 	vertices = buildVertices();
 
-	VkBuffer stagingBuffer;
-	VkDeviceMemory stagingMemory;
-
 	const VkDeviceSize bufferSize = sizeof(Vertex) * vertices.size();
-	const VkBufferUsageFlags stagingBufferUsageFlags = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-	const VkMemoryPropertyFlags stagingMemPropertyFlags = VK_MEMORY_PROPERTY_HOST_COHERENT_BIT |
-		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
-
-	createBuffer(bufferSize, stagingBufferUsageFlags, stagingMemPropertyFlags,
-		&stagingBuffer, &stagingMemory);
-
-	void* mappedMemory;
-	VkResult result = vkMapMemory(device->getHandle(), stagingMemory, 0, bufferSize, 0, &mappedMemory);
-	throwIfMapMemoryFailed(result);
-
-	memcpy(mappedMemory, vertices.data(), bufferSize);
-	vkUnmapMemory(device->getHandle(), stagingMemory);
-
 	const VkBufferUsageFlags vertexBufferUsageFlags = VK_BUFFER_USAGE_TRANSFER_DST_BIT |
 		VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
 	const VkMemoryPropertyFlags vertexMemPropertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
 
 	createBuffer(bufferSize, vertexBufferUsageFlags, vertexMemPropertyFlags, &vkVertexBuffer,
-		&vkVertexDeviceMemory);
+		&vertexAllocation);
 
-	copyBuffer(commandPool, bufferSize, stagingBuffer, vkVertexBuffer);
-
-	vkDestroyBuffer(device->getHandle(), stagingBuffer, nullptr);
-	vkFreeMemory(device->getHandle(), stagingMemory, nullptr);
+	uploadManager->upload(vkVertexBuffer, 0, vertices.data(), bufferSize);
 }
 
 std::vector<Vertex> VertexBuffer::buildVertices() const
@@ -72,21 +54,24 @@ std::vector<Vertex> VertexBuffer::buildVertices() const
 	return vertices;
 }
 
-void VertexBuffer::throwIfMapMemoryFailed(VkResult result) const
-{
-	if (result != VK_SUCCESS)
-	{
-		throw std::runtime_error("Failed to map vertex memory.");
-	}
-}
-
 VertexBuffer::~VertexBuffer()
 {
-	vkDestroyBuffer(device->getHandle(), vkVertexBuffer, nullptr);
-	vkFreeMemory(device->getHandle(), vkVertexDeviceMemory, nullptr);
+	destroyBuffer(vkVertexBuffer, vertexAllocation);
 }
 
 VkBuffer VertexBuffer::getHandle() const
 {
 	return vkVertexBuffer;
+}
+
+float VertexBuffer::getBoundingRadius() const
+{
+	float radius = 0.0f;
+
+	for (const Vertex& vertex : vertices)
+	{
+		radius = std::max(radius, glm::length(vertex.position));
+	}
+
+	return radius;
 }
\ No newline at end of file
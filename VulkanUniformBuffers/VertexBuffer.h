@@ -5,7 +5,8 @@
 #include "Buffer.h"
 #include "Vertex.h"
 
-class CommandPool;
+class UploadManager;
+class MemoryAllocator;
 
 
 class VertexBuffer : public Buffer
@@ -13,16 +14,16 @@ class VertexBuffer : public Buffer
 private:
 	std::vector<Vertex> vertices;
 	VkBuffer vkVertexBuffer;
-	VkDeviceMemory vkVertexDeviceMemory;
+	MemoryAllocation vertexAllocation;
 
-	void throwIfMapMemoryFailed(VkResult result) const;
 	std::vector<Vertex> buildVertices() const;
 
 public:
 	VertexBuffer(std::shared_ptr<PhysicalDevice> physicalDevice, std::shared_ptr<Device> device,
-		std::shared_ptr<CommandPool> commandPool);
+		std::shared_ptr<MemoryAllocator> memoryAllocator, std::shared_ptr<UploadManager> uploadManager);
 
 	~VertexBuffer();
 
 	VkBuffer getHandle() const;
+	float getBoundingRadius() const;
 };
\ No newline at end of file
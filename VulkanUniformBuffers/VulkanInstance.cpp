@@ -56,6 +56,11 @@ void VulkanInstance::addValidationLayers(VkInstanceCreateInfo* outVkInstanceCrea
 
 std::vector<const char*> VulkanInstance::buildExtensions(SDL_Window* sdlWindow, std::vector<const char*>* outExtensions) const
 {
+	if (sdlWindow == nullptr)
+	{
+		return extensions;
+	}
+
 	unsigned int extensionCount;
 	SDL_Vulkan_GetInstanceExtensions(sdlWindow, &extensionCount, nullptr);
 	outExtensions->resize(extensionCount);
@@ -13,7 +13,7 @@ private:
 	const uint32_t APPLICATION_VERSION = VK_MAKE_VERSION(1, 0, 0);
 	const char* ENGINE_NAME = "Engine Name";
 	const uint32_t ENGINE_VERSION = VK_MAKE_VERSION(1, 0, 0);
-	const uint32_t API_VERSION = VK_API_VERSION_1_0;
+	const uint32_t API_VERSION = VK_API_VERSION_1_1;
 	const char* VALIDATION_LAYER_NAME = "VK_LAYER_KHRONOS_validation";
 
 	std::vector<const char*> extensions;
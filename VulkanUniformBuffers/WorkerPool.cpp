@@ -0,0 +1,139 @@
+#include "WorkerPool.h"
+#include <algorithm>
+
+
+WorkerPool::WorkerPool(uint32_t workerCount)
+	: generation(0),
+	pendingWorkers(0),
+	stopping(false),
+	jobCount(0)
+{
+	this->workerCount = std::max(workerCount, 1u);
+
+	for (uint32_t i = 1; i < this->workerCount; ++i)
+	{
+		workers.emplace_back(&WorkerPool::runWorker, this, i);
+	}
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+
+	startCondition.notify_all();
+
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+}
+
+// Job i runs on worker i, so callers can keep per-worker state indexed by the job. The calling thread takes
+// job 0 itself, and a single job never wakes the workers. The first failure is rethrown once every job is done.
+void WorkerPool::run(uint32_t jobCount, const std::function<void(uint32_t)>& job)
+{
+	jobCount = std::min(jobCount, workerCount);
+
+	if (jobCount == 0)
+	{
+		return;
+	}
+
+	if (jobCount > 1)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			this->job = job;
+			this->jobCount = jobCount;
+			pendingWorkers = jobCount - 1;
+			++generation;
+		}
+
+		startCondition.notify_all();
+	}
+
+	std::exception_ptr callerFailure;
+
+	try
+	{
+		job(0);
+	}
+	catch (...)
+	{
+		callerFailure = std::current_exception();
+	}
+
+	if (jobCount > 1)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		doneCondition.wait(lock, [this] { return pendingWorkers == 0; });
+
+		if (!callerFailure)
+		{
+			callerFailure = failure;
+		}
+
+		failure = nullptr;
+	}
+
+	if (callerFailure)
+	{
+		std::rethrow_exception(callerFailure);
+	}
+}
+
+void WorkerPool::runWorker(uint32_t workerIndex)
+{
+	uint64_t seenGeneration = 0;
+
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			startCondition.wait(lock, [this, seenGeneration] { return stopping || generation != seenGeneration; });
+
+			if (stopping)
+			{
+				return;
+			}
+
+			seenGeneration = generation;
+
+			if (workerIndex >= jobCount)
+			{
+				continue;
+			}
+		}
+
+		std::exception_ptr jobFailure;
+
+		try
+		{
+			job(workerIndex);
+		}
+		catch (...)
+		{
+			jobFailure = std::current_exception();
+		}
+
+		std::lock_guard<std::mutex> lock(mutex);
+
+		if (jobFailure && !failure)
+		{
+			failure = jobFailure;
+		}
+
+		if (--pendingWorkers == 0)
+		{
+			doneCondition.notify_one();
+		}
+	}
+}
+
+uint32_t WorkerPool::getWorkerCount() const
+{
+	return workerCount;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+
+class WorkerPool
+{
+private:
+	uint32_t workerCount;
+	std::vector<std::thread> workers;
+	std::mutex mutex;
+	std::condition_variable startCondition;
+	std::condition_variable doneCondition;
+	uint64_t generation;
+	uint32_t pendingWorkers;
+	bool stopping;
+	std::exception_ptr failure;
+
+	std::function<void(uint32_t)> job;
+	uint32_t jobCount;
+
+	void runWorker(uint32_t workerIndex);
+
+public:
+	WorkerPool(uint32_t workerCount);
+	~WorkerPool();
+
+	void run(uint32_t jobCount, const std::function<void(uint32_t)>& job);
+	uint32_t getWorkerCount() const;
+};
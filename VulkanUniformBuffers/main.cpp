@@ -1,12 +1,291 @@
 #include <memory>
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <cmath>
+#include <thread>
 #include "Engine.h"
+#include <glm/gtc/matrix_transform.hpp>
 #include "SdlWindow.h"
+#include "HeadlessRunner.h"
+#include "PresentPolicy.h"
+#include "VertexTransformMode.h"
+#include "CullingMode.h"
+#include "CommandRecordingMode.h"
+#include "CullingBenchmark.h"
 
 
+PresentPolicy parsePresentPolicy(const char* name)
+{
+	if (strcmp(name, "mailbox") == 0)
+	{
+		return PresentPolicy::Mailbox;
+	}
+
+	if (strcmp(name, "immediate") == 0)
+	{
+		return PresentPolicy::Immediate;
+	}
+
+	if (strcmp(name, "fifo-relaxed") == 0)
+	{
+		return PresentPolicy::FifoRelaxed;
+	}
+
+	return PresentPolicy::Vsync;
+}
+
+VertexTransformMode parseVertexTransformMode(const char* name)
+{
+	if (strcmp(name, "separate") == 0)
+	{
+		return VertexTransformMode::Separate;
+	}
+
+	return VertexTransformMode::Premultiplied;
+}
+
+CullingMode parseCullingMode(const char* name)
+{
+	if (strcmp(name, "off") == 0)
+	{
+		return CullingMode::Off;
+	}
+
+	if (strcmp(name, "cpu") == 0)
+	{
+		return CullingMode::Cpu;
+	}
+
+	return CullingMode::Gpu;
+}
+
+CommandRecordingMode parseCommandRecordingMode(const char* name)
+{
+	if (strcmp(name, "per-frame") == 0)
+	{
+		return CommandRecordingMode::PerFrame;
+	}
+
+	return CommandRecordingMode::Prerecorded;
+}
+
+// The scene starts with one cube at the origin; the rest are laid out in a grid receding from the camera.
+void addInstanceGrid(Engine& engine, int instanceCount)
+{
+	uint32_t count = std::min(static_cast<uint32_t>(instanceCount), engine.getMaxInstanceCount());
+	uint32_t side = static_cast<uint32_t>(std::ceil(std::cbrt(static_cast<double>(count))));
+	const float spacing = 2.0f;
+
+	for (uint32_t i = 1; i < count; ++i)
+	{
+		uint32_t x = i % side;
+		uint32_t y = (i / side) % side;
+		uint32_t z = i / (side * side);
+
+		InstanceData instanceData;
+		instanceData.model = glm::translate(glm::mat4(1.0f),
+			glm::vec3(x * spacing, y * spacing, -(z * spacing)));
+		instanceData.color = glm::vec4(0.5f + 0.5f * x / side, 0.5f + 0.5f * y / side, 0.5f + 0.5f * z / side, 1.0f);
+
+		engine.addInstance(instanceData);
+	}
+
+	std::cout << "instances: " << engine.getInstanceCount() << std::endl;
+}
+
+// Scene objects each draw the whole instance grid, so they are lined up along x one grid width apart. Applied after
+// init, so the first rendered frame already draws with transforms that differ from the ones the command buffers
+// were created with.
+void placeSceneObjects(Engine& engine, float degrees)
+{
+	if (engine.getSceneObjectCount() == 1 && degrees == 0.0f)
+	{
+		return;
+	}
+
+	uint32_t side = static_cast<uint32_t>(std::ceil(std::cbrt(static_cast<double>(engine.getInstanceCount()))));
+	const float spacing = (side + 1) * 2.0f;
+	glm::mat4 rotation = glm::rotate(glm::mat4(1.0f), glm::radians(degrees), glm::vec3(0.0f, 1.0f, 0.0f));
+
+	for (uint32_t i = 0; i < engine.getSceneObjectCount(); ++i)
+	{
+		engine.setSceneObjectModel(i, glm::translate(glm::mat4(1.0f), glm::vec3(i * spacing, 0.0f, 0.0f)) * rotation);
+	}
+}
+
+void printInitReport(const Engine& engine)
+{
+	double serialMs = 0.0;
+
+	for (const TaskTiming& timing : engine.getInitTimings())
+	{
+		serialMs += timing.endMs - timing.startMs;
+
+		std::cout << (timing.onCriticalPath ? "* " : "  ") << timing.name << ": worker " << timing.workerIndex
+			<< ", " << timing.startMs << " - " << timing.endMs << " ms (" << timing.endMs - timing.startMs
+			<< " ms)" << std::endl;
+	}
+
+	std::cout << "init: " << engine.getInitWallTimeMs() << " ms wall, " << serialMs << " ms serial, "
+		<< engine.getInitCriticalPathMs() << " ms critical path (*)" << std::endl;
+}
+
+void printStartupReport(const Engine& engine)
+{
+	printInitReport(engine);
+
+	std::cout << "frame sync: " << (engine.isTimelineSyncActive() ? "timeline semaphore" : "fences") << std::endl;
+
+	std::cout << "pipeline creation (" << (engine.isPipelineCacheWarm() ? "warm" : "cold") << " cache): "
+		<< engine.getPipelineCreationTimeMs() << " ms" << std::endl;
+
+	std::cout << "command recording: " << (engine.isPerFrameRecordingActive() ? "per-frame" : "prerecorded") << ", "
+		<< engine.getSceneObjectCount() << " scene objects, " << engine.getActiveRecordingWorkerCount()
+		<< " recording workers" << std::endl;
+}
+
+void runCullingBenchmark(int iterationCount)
+{
+	const std::vector<uint32_t> objectCounts = { 1000, 10000, 100000, 1000000 };
+	uint32_t workerCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+	CullingBenchmark cullingBenchmark(static_cast<uint32_t>(iterationCount));
+	std::vector<CullingBenchmarkResult> results = cullingBenchmark.runAll(objectCounts, workerCount);
+
+	std::cout << "kernel,objects,workers,visible,avg_ms,p95_ms" << std::endl;
+
+	for (const CullingBenchmarkResult& result : results)
+	{
+		std::cout << result.kernelName
+			<< "," << result.objectCount
+			<< "," << result.workerCount
+			<< "," << result.visibleCount
+			<< "," << result.stats.averageMs
+			<< "," << result.stats.p95Ms << std::endl;
+	}
+}
+
 int main(int argc, char* args[]) 
 {
 	auto engine = std::make_shared<Engine>();
+	int comparisonFrameCount = 0;
+	int headlessFrameCount = 0;
+	int uniformBenchmarkFrameCount = 0;
+	int cullingBenchmarkIterationCount = 0;
+	int instanceCount = 1;
+	float objectRotation = 0.0f;
+	bool commandRecordingModeSet = false;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(args[i], "--frames-in-flight") == 0 && i + 1 < argc)
+		{
+			engine->setFramesInFlight(atoi(args[++i]));
+		}
+		else if (strcmp(args[i], "--present-mode") == 0 && i + 1 < argc)
+		{
+			engine->setPresentPolicy(parsePresentPolicy(args[++i]));
+		}
+		else if (strcmp(args[i], "--vertex-transform") == 0 && i + 1 < argc)
+		{
+			engine->setVertexTransformMode(parseVertexTransformMode(args[++i]));
+		}
+		else if (strcmp(args[i], "--compare-frames-in-flight") == 0 && i + 1 < argc)
+		{
+			comparisonFrameCount = atoi(args[++i]);
+		}
+		else if (strcmp(args[i], "--sync") == 0 && i + 1 < argc)
+		{
+			engine->setTimelineSyncEnabled(strcmp(args[++i], "fences") != 0);
+		}
+		else if (strcmp(args[i], "--init-workers") == 0 && i + 1 < argc)
+		{
+			engine->setInitWorkerCount(static_cast<uint32_t>(std::max(atoi(args[++i]), 1)));
+		}
+		else if (strcmp(args[i], "--command-recording") == 0 && i + 1 < argc)
+		{
+			engine->setCommandRecordingMode(parseCommandRecordingMode(args[++i]));
+			commandRecordingModeSet = true;
+		}
+		else if (strcmp(args[i], "--record-workers") == 0 && i + 1 < argc)
+		{
+			engine->setRecordingWorkerCount(static_cast<uint32_t>(std::max(atoi(args[++i]), 1)));
+		}
+		else if (strcmp(args[i], "--headless") == 0 && i + 1 < argc)
+		{
+			headlessFrameCount = std::max(atoi(args[++i]), 1);
+		}
+		else if (strcmp(args[i], "--uniform-benchmark") == 0 && i + 1 < argc)
+		{
+			uniformBenchmarkFrameCount = std::max(atoi(args[++i]), 1);
+		}
+		else if (strcmp(args[i], "--culling-benchmark") == 0 && i + 1 < argc)
+		{
+			cullingBenchmarkIterationCount = std::max(atoi(args[++i]), 1);
+		}
+		else if (strcmp(args[i], "--culling") == 0 && i + 1 < argc)
+		{
+			engine->setCullingMode(parseCullingMode(args[++i]));
+		}
+		else if (strcmp(args[i], "--instances") == 0 && i + 1 < argc)
+		{
+			instanceCount = std::max(atoi(args[++i]), 1);
+		}
+		else if (strcmp(args[i], "--scene-objects") == 0 && i + 1 < argc)
+		{
+			engine->setSceneObjectCount(static_cast<uint32_t>(std::max(atoi(args[++i]), 1)));
+		}
+		else if (strcmp(args[i], "--object-rotation") == 0 && i + 1 < argc)
+		{
+			objectRotation = static_cast<float>(atof(args[++i]));
+		}
+	}
+
+	// Placed scene objects change their transforms after the command buffers are recorded, so they record per frame
+	// unless a recording mode was asked for.
+	if (!commandRecordingModeSet && (engine->getSceneObjectCount() > 1 || objectRotation != 0.0f))
+	{
+		engine->setCommandRecordingMode(CommandRecordingMode::PerFrame);
+	}
+
+	if (cullingBenchmarkIterationCount > 0)
+	{
+		runCullingBenchmark(cullingBenchmarkIterationCount);
+		return 0;
+	}
+
+	if (uniformBenchmarkFrameCount > 0)
+	{
+		HeadlessRunner headlessRunner(engine);
+		headlessRunner.runUniformBenchmark(uniformBenchmarkFrameCount);
+		return 0;
+	}
+
+	if (headlessFrameCount > 0)
+	{
+		HeadlessRunner headlessRunner(engine);
+		addInstanceGrid(*engine, instanceCount);
+		placeSceneObjects(*engine, objectRotation);
+		printStartupReport(*engine);
+		headlessRunner.run(headlessFrameCount);
+		return 0;
+	}
+
 	SdlWindow sdlWindow(engine);
-	sdlWindow.runMainLoop();
+	addInstanceGrid(*engine, instanceCount);
+	placeSceneObjects(*engine, objectRotation);
+	printStartupReport(*engine);
+
+	if (comparisonFrameCount > 0)
+	{
+		sdlWindow.runFramesInFlightComparison(comparisonFrameCount);
+	}
+	else
+	{
+		sdlWindow.runMainLoop();
+	}
+
 	return 0;
 }
\ No newline at end of file
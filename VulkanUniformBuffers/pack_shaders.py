@@ -0,0 +1,62 @@
+import os
+import struct
+import sys
+
+PACK_MAGIC = 0x4B415053
+PACK_VERSION = 1
+NAME_SIZE = 32
+HEADER_FORMAT = '<III'
+ENTRY_FORMAT = '<%dsII' % NAME_SIZE
+
+
+def build_pack(shader_paths):
+    index_size = struct.calcsize(HEADER_FORMAT) + len(shader_paths) * struct.calcsize(ENTRY_FORMAT)
+    entries = b''
+    blobs = b''
+
+    for path in shader_paths:
+        with open(path, 'rb') as shader_file:
+            code = shader_file.read()
+
+        if len(code) % 4 != 0:
+            raise ValueError('SPIR-V size of %s is not a multiple of 4' % path)
+
+        name = os.path.basename(path).encode('ascii')
+        if len(name) >= NAME_SIZE:
+            raise ValueError('shader name %s is too long' % path)
+
+        entries += struct.pack(ENTRY_FORMAT, name, index_size + len(blobs), len(code))
+        blobs += code
+
+    return struct.pack(HEADER_FORMAT, PACK_MAGIC, PACK_VERSION, len(shader_paths)) + entries + blobs
+
+
+def write_embedded_header(path, pack):
+    words = struct.unpack('<%dI' % (len(pack) // 4), pack)
+
+    with open(path, 'w') as header_file:
+        header_file.write('#pragma once\n\n#include <cstdint>\n\n')
+        header_file.write('constexpr uint32_t SHADER_PACK_DATA[] =\n{\n')
+
+        for i in range(0, len(words), 8):
+            header_file.write('\t' + ', '.join('0x%08x' % word for word in words[i:i + 8]) + ',\n')
+
+        header_file.write('};\n')
+
+
+def main():
+    if len(sys.argv) < 4:
+        print('usage: pack_shaders.py <pack file> <embedded header> <shader.spv>...')
+        return 1
+
+    pack = build_pack(sys.argv[3:])
+
+    with open(sys.argv[1], 'wb') as pack_file:
+        pack_file.write(pack)
+
+    write_embedded_header(sys.argv[2], pack)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
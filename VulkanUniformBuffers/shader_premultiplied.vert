@@ -0,0 +1,23 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+
+layout(binding = 0) uniform UniformBufferObject {
+	mat4 view;
+	mat4 projection;
+	mat4 viewProjection;
+} ubo;
+
+layout(push_constant) uniform ObjectPushConstants {
+	mat4 model;
+} object;
+
+layout(location = 0) in vec3 vertPosition;
+layout(location = 1) in vec3 vertColor;
+layout(location = 2) in mat4 instanceModel;
+layout(location = 6) in vec4 instanceColor;
+layout(location = 0) out vec3 fragColor;
+
+void main() {
+    gl_Position = ubo.viewProjection * (object.model * (instanceModel * vec4(vertPosition, 1.0)));
+    fragColor = vertColor * instanceColor.rgb;
+}
\ No newline at end of file